@@ -388,6 +388,7 @@ if (NOT MUSE_ENABLE_UNIT_TESTS)
 
     set(MUE_BUILD_BRAILLE_TESTS OFF)
     set(MUE_BUILD_ENGRAVING_TESTS OFF)
+    set(MUE_BUILD_ENGRAVING_BENCHMARKS OFF)
     set(MUE_BUILD_IMPORTEXPORT_TESTS OFF)
     set(MUE_BUILD_NOTATION_TESTS OFF)
     set(MUE_BUILD_NOTATIONSCENE_TESTS OFF)
@@ -50,3 +50,9 @@ echo Generate current pngs:
 ./vtest/vtest-generate-pngs.sh -o ./current_pngs -m $CUR_BIN
 ./vtest/vtest-generate-pngs.sh -o ./current_pngs_small -m $CUR_BIN -s ./vtest/scores_small -d 460 -S ./vtest/small.mss
 ./vtest/vtest-generate-pngs.sh -o ./current_pngs_gp_small -m $CUR_BIN -s ./vtest/gp_small -d 460 -S ./vtest/small.mss --gp-linked
+
+echo ====================
+echo ==== Batch jobs ====
+echo ====================
+
+./vtest/vtest-batch-jobs.sh -o ./batch_jobs -m $CUR_BIN -s ./vtest/scores_small -j 4
@@ -90,6 +90,9 @@ void CommandLineParser::init()
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
     m_parser.addOption(QCommandLineOption("extension", "Use extension to process a conversion job", "uri"));
+    m_parser.addOption(QCommandLineOption("jobs",
+                                          "Use with '-j <file>', run up to 'count' conversions of the job file in parallel. "
+                                          "0 uses one per CPU core", "count"));
 
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -481,6 +484,15 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options->converterTask.params[MuseScoreCmdOptions::ParamKey::ExtensionUri] = m_parser.value("extension");
     }
 
+    if (m_parser.isSet("jobs")) {
+        std::optional<int> val = intValue("jobs");
+        if (val && val.value() >= 0) {
+            m_options->converterTask.params[MuseScoreCmdOptions::ParamKey::JobsCount] = val.value();
+        } else {
+            LOGE() << "Option: --jobs not recognized count value: " << m_parser.value("jobs");
+        }
+    }
+
     if (m_parser.isSet("gp-linked")) {
         m_options->guitarPro.linkedTabStaffCreated = true;
     }
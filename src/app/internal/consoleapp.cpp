@@ -211,9 +211,10 @@ int MuseScoreConsoleApp::processConverter(const MuseScoreCmdOptions::ConverterTa
     openParams.unrollRepeats = task.params[MuseScoreCmdOptions::ParamKey::UnrollRepeats].toBool();
 
     switch (task.type) {
-    case ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, openParams, soundProfile, extensionUri);
-        break;
+    case ConvertType::Batch: {
+        size_t jobsCount = task.params.value(MuseScoreCmdOptions::ParamKey::JobsCount, 1).toUInt();
+        ret = converter()->batchConvert(task.inputFile, openParams, soundProfile, extensionUri, nullptr, jobsCount);
+    } break;
     case ConvertType::File: {
         std::string transposeOptionsJson = task.params[MuseScoreCmdOptions::ParamKey::ScoreTransposeOptions].toString().toStdString();
         std::optional<ConvertTarget> target = parseTarget(task.params);
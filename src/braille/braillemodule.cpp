@@ -56,7 +56,7 @@ void BrailleModule::resolveImports()
 {
     auto writers = globalIoc()->resolve<INotationWritersRegister>(mname);
     if (writers) {
-        writers->reg({ "brf" }, std::make_shared<BrailleWriter>());
+        writers->reg({ "brf" }, []() { return std::make_shared<BrailleWriter>(); });
     }
 }
 
@@ -44,7 +44,7 @@ public:
 
     virtual muse::Ret batchConvert(const muse::io::path_t& batchJobFile, const OpenParams& openParams = {},
                                    const muse::String& soundProfile = {}, const muse::UriQuery& extensionUri = {},
-                                   muse::ProgressPtr progress = nullptr) = 0;
+                                   muse::ProgressPtr progress = nullptr, size_t jobsCount = 1) = 0;
 
     virtual muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {}) = 0;
 
@@ -21,6 +21,15 @@
  */
 #include "convertercontroller.h"
 
+#ifdef MUSE_THREADS_SUPPORT
+#include <atomic>
+#include <future>
+#include <thread>
+#endif
+
+#include <numeric>
+#include <unordered_map>
+
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -29,6 +38,7 @@
 #include "global/defer.h"
 #include "global/io/buffer.h"
 #include "global/io/file.h"
+#include "global/io/filestream.h"
 #include "global/io/dir.h"
 
 #include "engraving/dom/masterscore.h"
@@ -54,7 +64,7 @@ static const std::string MP3_SUFFIX = "mp3";
 
 Ret ConverterController::batchConvert(const path_t& batchJobFile, const OpenParams& openParams,
                                       const String& soundProfile, const UriQuery& extensionUri,
-                                      ProgressPtr progress)
+                                      ProgressPtr progress, size_t jobsCount)
 {
     TRACEFUNC;
 
@@ -71,19 +81,125 @@ Ret ConverterController::batchConvert(const path_t& batchJobFile, const OpenPara
         return batchJob.ret;
     }
 
+    const BatchJob& jobs = batchJob.val;
+
+    //! NOTE Jobs with the same input and the same setup are converted from one loaded project
+    const std::vector<JobGroup> groups = groupJobs(jobs, extensionUri);
+
+    std::vector<size_t> jobGroupIdx(jobs.size());
+    for (size_t g = 0; g < groups.size(); ++g) {
+        for (size_t jobIdx : groups.at(g)) {
+            jobGroupIdx[jobIdx] = g;
+        }
+    }
+
+    std::vector<Ret> results(jobs.size());
+    std::vector<bool> groupConverted(groups.size(), false);
+
+    auto storeResults = [&](size_t groupIdx, const std::vector<Ret>& groupResults) {
+        const JobGroup& group = groups.at(groupIdx);
+        for (size_t i = 0; i < group.size(); ++i) {
+            results[group.at(i)] = groupResults.at(i);
+        }
+        groupConverted[groupIdx] = true;
+    };
+
+#ifdef MUSE_THREADS_SUPPORT
+    if (jobsCount == 0) {
+        jobsCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    //! NOTE Chains of groups that don't depend on the global context are converted by a pool of workers.
+    //! The projects are loaded here, on the calling thread, the workers only write the outputs.
+    //! Groups writing to a common output are in the same chain, so they write it in the job order.
+    //! The results are collected in the job order, so progress, errors and outputs are the same
+    //! as when converting one by one
+    std::vector<GroupChain> parallelChains;
+    if (jobsCount > 1) {
+        for (const GroupChain& chain : chainGroups(jobs, groups)) {
+            bool parallel = std::all_of(chain.cbegin(), chain.cend(), [&](size_t groupIdx) {
+                const JobGroup& group = groups.at(groupIdx);
+                return std::all_of(group.cbegin(), group.cend(), [&](size_t jobIdx) {
+                    return canConvertInParallel(jobs.at(jobIdx), soundProfile, extensionUri);
+                });
+            });
+
+            if (parallel) {
+                parallelChains.push_back(chain);
+            }
+        }
+    }
+
+    std::vector<std::future<std::vector<std::vector<Ret> > > > chainFutures;
+    std::unordered_map<size_t, size_t> groupChainIdx;
+
+    if (parallelChains.size() > 1) {
+        //! NOTE Fonts are loaded lazily, make sure the workers don't do it
+        engravingFonts()->loadAllFonts();
+        engravingFonts()->fallbackFont();
+
+        for (size_t c = 0; c < parallelChains.size(); ++c) {
+            //! NOTE Don't keep more projects loaded than there are workers
+            if (c >= jobsCount) {
+                chainFutures.at(c - jobsCount).wait();
+            }
+
+            const GroupChain& chain = parallelChains.at(c);
+            std::vector<RetVal<INotationProjectPtr> > projects;
+            for (size_t groupIdx : chain) {
+                groupChainIdx[groupIdx] = c;
+                projects.push_back(loadJobGroupProject(jobs, groups.at(groupIdx), openParams, soundProfile));
+            }
+
+            chainFutures.push_back(std::async(std::launch::async, [this, &jobs, &groups, &parallelChains, &extensionUri, c,
+                                                                   chainProjects = std::move(projects)]() mutable {
+                //! NOTE Release the projects when done, not when the future is destroyed
+                std::vector<RetVal<INotationProjectPtr> > loaded = std::move(chainProjects);
+
+                const GroupChain& chain = parallelChains.at(c);
+                std::vector<std::vector<Ret> > chainResults;
+                for (size_t i = 0; i < chain.size(); ++i) {
+                    chainResults.push_back(convertLoadedJobGroup(jobs, groups.at(chain.at(i)), loaded.at(i), extensionUri, true));
+                }
+                return chainResults;
+            }));
+        }
+    }
+#else
+    UNUSED(jobsCount);
+#endif
+
     StringList errors;
 
     int64_t current = 0;
-    int64_t total = batchJob.val.size();
-    for (const Job& job : batchJob.val) {
+    int64_t total = jobs.size();
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        const Job& job = jobs.at(i);
+
         if (progress) {
             ++current;
             progress->progress(current, total, job.in.toStdString());
         }
 
-        Ret ret = convertFile(job.in, job.out, openParams, soundProfile, job.tracksDiffPath, extensionUri, job.transposeOptions,
-                              job.pageNum, job.visibleParts,
-                              job.copyright);
+        size_t groupIdx = jobGroupIdx.at(i);
+        if (!groupConverted.at(groupIdx)) {
+#ifdef MUSE_THREADS_SUPPORT
+            auto it = groupChainIdx.find(groupIdx);
+            if (it != groupChainIdx.end()) {
+                const GroupChain& chain = parallelChains.at(it->second);
+                std::vector<std::vector<Ret> > chainResults = chainFutures.at(it->second).get();
+                for (size_t c = 0; c < chain.size(); ++c) {
+                    storeResults(chain.at(c), chainResults.at(c));
+                }
+            } else {
+                storeResults(groupIdx, convertJobGroup(jobs, groups.at(groupIdx), openParams, soundProfile, extensionUri));
+            }
+#else
+            storeResults(groupIdx, convertJobGroup(jobs, groups.at(groupIdx), openParams, soundProfile, extensionUri));
+#endif
+        }
+
+        const Ret& ret = results.at(i);
         if (!ret) {
             errors.emplace_back(String(u"failed convert, err: %1, in: %2, out: %3")
                                 .arg(String::fromStdString(ret.toString())).arg(job.in.toString()).arg(job.out.toString()));
@@ -104,6 +220,244 @@ Ret ConverterController::batchConvert(const path_t& batchJobFile, const OpenPara
     return ret;
 }
 
+std::vector<ConverterController::JobGroup> ConverterController::groupJobs(const BatchJob& batchJob, const UriQuery& extensionUri) const
+{
+    std::vector<JobGroup> groups;
+    std::unordered_map<std::string, std::vector<size_t> > groupsByInput;
+
+    for (size_t i = 0; i < batchJob.size(); ++i) {
+        const Job& job = batchJob.at(i);
+
+        //! NOTE Extensions modify the score, and the tracks diff needs the tracks before the sound profile is applied.
+        //! Part exports initialise the excerpts of the project, which changes what a later save of it writes,
+        //! so they are converted from a project of their own
+        const bool isPartsExport = io::completeBasename(job.out).toStdString().find('*') != std::string::npos;
+        if (extensionUri.isValid() || !job.tracksDiffPath.empty() || isPartsExport) {
+            groups.push_back({ i });
+            continue;
+        }
+
+        std::vector<size_t>& inputGroups = groupsByInput[job.in.toStdString()];
+
+        bool added = false;
+        for (size_t groupIdx : inputGroups) {
+            JobGroup& group = groups.at(groupIdx);
+            if (canShareProject(batchJob.at(group.front()), job)) {
+                group.push_back(i);
+                added = true;
+                break;
+            }
+        }
+
+        if (!added) {
+            inputGroups.push_back(groups.size());
+            groups.push_back({ i });
+        }
+    }
+
+    return groups;
+}
+
+bool ConverterController::canShareProject(const Job& job1, const Job& job2) const
+{
+    return job1.in == job2.in
+           && job1.transposeOptions == job2.transposeOptions
+           && job1.visibleParts == job2.visibleParts
+           && job1.copyright.text == job2.copyright.text
+           && job1.copyright.showOnAllPages == job2.copyright.showOnAllPages;
+}
+
+bool ConverterController::canWriteSameFile(const Job& job1, const Job& job2) const
+{
+    //! NOTE Part and page by page exports write several files, whose names are only known after loading,
+    //! so only the common beginning of their names is compared
+    struct OutputFiles {
+        std::string name;
+        std::string suffix;
+        bool isPrefix = false;
+    };
+
+    auto outputFiles = [this](const Job& job) {
+        OutputFiles files;
+        files.suffix = io::suffix(job.out);
+
+        const std::string path = io::dirpath(job.out).toStdString() + "/";
+        const std::string baseName = io::completeBasename(job.out).toStdString();
+        const bool isSave = files.suffix == engraving::MSCZ || files.suffix == engraving::MSCX || files.suffix == engraving::MSCS;
+
+        size_t partNamePos = baseName.find('*');
+        if (partNamePos != std::string::npos) {
+            files.name = path + baseName.substr(0, partNamePos);
+            files.isPrefix = true;
+        } else if (!isSave && !job.pageNum.has_value() && isConvertPageByPage(files.suffix)) {
+            files.name = path + baseName + "-";
+            files.isPrefix = true;
+        } else {
+            files.name = path + baseName;
+        }
+
+        return files;
+    };
+
+    const OutputFiles files1 = outputFiles(job1);
+    const OutputFiles files2 = outputFiles(job2);
+
+    if (files1.suffix != files2.suffix) {
+        return false;
+    }
+
+    auto startsWith = [](const std::string& str, const std::string& prefix) {
+        return str.compare(0, prefix.size(), prefix) == 0;
+    };
+
+    if (files1.isPrefix && startsWith(files2.name, files1.name)) {
+        return true;
+    }
+
+    if (files2.isPrefix && startsWith(files1.name, files2.name)) {
+        return true;
+    }
+
+    return files1.name == files2.name;
+}
+
+std::vector<ConverterController::GroupChain> ConverterController::chainGroups(const BatchJob& batchJob,
+                                                                              const std::vector<JobGroup>& groups) const
+{
+    //! NOTE Groups are joined when they can write to a common output file
+    std::vector<size_t> root(groups.size());
+    std::iota(root.begin(), root.end(), 0);
+
+    auto findRoot = [&root](size_t groupIdx) {
+        while (root.at(groupIdx) != groupIdx) {
+            groupIdx = root[groupIdx] = root.at(root.at(groupIdx));
+        }
+        return groupIdx;
+    };
+
+    for (size_t g1 = 0; g1 < groups.size(); ++g1) {
+        for (size_t g2 = g1 + 1; g2 < groups.size(); ++g2) {
+            bool sameFile = std::any_of(groups.at(g1).cbegin(), groups.at(g1).cend(), [&](size_t jobIdx1) {
+                return std::any_of(groups.at(g2).cbegin(), groups.at(g2).cend(), [&](size_t jobIdx2) {
+                    return canWriteSameFile(batchJob.at(jobIdx1), batchJob.at(jobIdx2));
+                });
+            });
+
+            if (sameFile) {
+                size_t root1 = findRoot(g1);
+                size_t root2 = findRoot(g2);
+                root[std::max(root1, root2)] = std::min(root1, root2);
+            }
+        }
+    }
+
+    //! NOTE The groups of a chain keep the order they are converted in one by one
+    std::vector<GroupChain> chains;
+    std::unordered_map<size_t, size_t> chainByRoot;
+    for (size_t g = 0; g < groups.size(); ++g) {
+        auto [it, inserted] = chainByRoot.emplace(findRoot(g), chains.size());
+        if (inserted) {
+            chains.emplace_back();
+        }
+        chains.at(it->second).push_back(g);
+    }
+
+    return chains;
+}
+
+bool ConverterController::canConvertInParallel(const Job& job, const String& soundProfile, const UriQuery& extensionUri) const
+{
+    //! NOTE Extensions, sound profiles and audio export work with the current project of the global context
+    static const std::unordered_set<std::string> AUDIO_TYPES {
+        MP3_SUFFIX,
+        "ogg",
+        "flac",
+        "wav",
+    };
+
+    if (extensionUri.isValid() || !soundProfile.isEmpty() || !job.tracksDiffPath.empty()) {
+        return false;
+    }
+
+    const std::string suffix = io::suffix(job.out);
+    if (muse::contains(AUDIO_TYPES, suffix)) {
+        return false;
+    }
+
+    //! NOTE The registered writers are shared, each parallel conversion needs writers of its own
+    return writers()->newWriter(suffix) != nullptr;
+}
+
+std::vector<Ret> ConverterController::convertJobGroup(const BatchJob& batchJob, const JobGroup& group, const OpenParams& openParams,
+                                                      const String& soundProfile, const UriQuery& extensionUri)
+{
+    TRACEFUNC;
+
+    const Job& first = batchJob.at(group.front());
+    if (group.size() == 1) {
+        return { convertFile(first.in, first.out, openParams, soundProfile, first.tracksDiffPath, extensionUri,
+                             first.transposeOptions, first.pageNum, first.visibleParts, first.copyright) };
+    }
+
+    return convertLoadedJobGroup(batchJob, group, loadJobGroupProject(batchJob, group, openParams, soundProfile), extensionUri, false);
+}
+
+RetVal<INotationProjectPtr> ConverterController::loadJobGroupProject(const BatchJob& batchJob, const JobGroup& group,
+                                                                     const OpenParams& openParams, const String& soundProfile)
+{
+    bool hasWriter = std::any_of(group.cbegin(), group.cend(), [&](size_t jobIdx) {
+        return writers()->writer(io::suffix(batchJob.at(jobIdx).out)) != nullptr;
+    });
+
+    //! NOTE Nothing to write, no need to load
+    if (!hasWriter) {
+        return make_ret(Err::ConvertTypeUnknown);
+    }
+
+    const Job& first = batchJob.at(group.front());
+    return loadProject(first.in, openParams, soundProfile, first.transposeOptions, first.visibleParts, first.copyright);
+}
+
+std::vector<Ret> ConverterController::convertLoadedJobGroup(const BatchJob& batchJob, const JobGroup& group,
+                                                            const RetVal<INotationProjectPtr>& project, const UriQuery& extensionUri,
+                                                            bool isolated)
+{
+    TRACEFUNC;
+
+    std::vector<Ret> results(group.size());
+
+    //! NOTE Saving changes the project path, which can be shown in headers and footers,
+    //! so the project is saved after all the exports
+    auto isSave = [&](size_t i) {
+        const std::string suffix = io::suffix(batchJob.at(group.at(i)).out);
+        return suffix == engraving::MSCZ || suffix == engraving::MSCX || suffix == engraving::MSCS;
+    };
+
+    std::vector<size_t> order(group.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_partition(order.begin(), order.end(), [&](size_t i) { return !isSave(i); });
+
+    for (size_t i : order) {
+        const Job& job = batchJob.at(group.at(i));
+
+        LOGI() << "in: " << job.in << ", out: " << job.out;
+
+        if (!writers()->writer(io::suffix(job.out))) {
+            results[i] = make_ret(Err::ConvertTypeUnknown);
+            continue;
+        }
+
+        if (!project.ret) {
+            results[i] = project.ret;
+            continue;
+        }
+
+        results[i] = convertProject(project.val, job.out, extensionUri, job.pageNum, {}, {}, isolated);
+    }
+
+    return results;
+}
+
 Ret ConverterController::fileConvert(const path_t& in, const path_t& out,
                                      const OpenParams& openParams,
                                      const String& soundProfile,
@@ -134,19 +488,35 @@ Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io:
                                      const std::optional<notation::TransposeOptions>& transposeOptions,
                                      const std::optional<ConvertTarget>& target,
                                      const std::vector<size_t>& visibleParts,
-                                     const CopyrightInfo& copyright)
+                                     const CopyrightInfo& copyright,
+                                     bool isolated)
 {
     TRACEFUNC;
 
     LOGI() << "in: " << in << ", out: " << out;
 
-    std::string suffix = io::suffix(out);
-
-    auto writer = writers()->writer(suffix);
+    auto writer = writers()->writer(io::suffix(out));
     if (!writer) {
         return make_ret(Err::ConvertTypeUnknown);
     }
 
+    QJsonArray oldTracks;
+    RetVal<INotationProjectPtr> notationProject = loadProject(in, openParams, soundProfile, transposeOptions, visibleParts, copyright,
+                                                              tracksDiffPath.empty() ? nullptr : &oldTracks);
+    if (!notationProject.ret) {
+        return notationProject.ret;
+    }
+
+    return convertProject(notationProject.val, out, extensionUri, target, tracksDiffPath, oldTracks, isolated);
+}
+
+RetVal<INotationProjectPtr> ConverterController::loadProject(const muse::io::path_t& in, const OpenParams& openParams,
+                                                             const String& soundProfile, const TransposeOpts& transposeOptions,
+                                                             const std::vector<size_t>& visibleParts, const CopyrightInfo& copyright,
+                                                             QJsonArray* oldTracks)
+{
+    TRACEFUNC;
+
     auto notationProject = notationCreator()->newProject(iocContext());
     IF_ASSERT_FAILED(notationProject) {
         return make_ret(Err::UnknownError);
@@ -158,9 +528,8 @@ Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io:
         return make_ret(Err::InFileFailedLoad);
     }
 
-    QJsonArray oldTracks;
-    if (!tracksDiffPath.empty()) {
-        oldTracks = NotationMeta::tracksJsonArray(notationProject->masterNotation()->notation());
+    if (oldTracks) {
+        *oldTracks = NotationMeta::tracksJsonArray(notationProject->masterNotation()->notation());
     }
 
     if (!soundProfile.isEmpty()) {
@@ -190,10 +559,36 @@ Ret ConverterController::convertFile(const muse::io::path_t& in, const muse::io:
         style.set(engraving::Sid::evenFooterC, footerEven);
     }
 
-    globalContext()->setCurrentProject(notationProject);
+    return RetVal<INotationProjectPtr>::make_ok(notationProject);
+}
+
+Ret ConverterController::convertProject(INotationProjectPtr notationProject, const muse::io::path_t& out,
+                                        const muse::UriQuery& extensionUri,
+                                        const std::optional<ConvertTarget>& target,
+                                        const path_t& tracksDiffPath,
+                                        const QJsonArray& oldTracks,
+                                        bool isolated)
+{
+    TRACEFUNC;
+
+    std::string suffix = io::suffix(out);
+
+    auto writer = isolated ? writers()->newWriter(suffix) : writers()->writer(suffix);
+    if (!writer) {
+        return make_ret(Err::ConvertTypeUnknown);
+    }
+
+    Ret ret = make_ok();
+
+    //! NOTE An isolated conversion runs in parallel with others, so it must not touch the global context
+    if (!isolated) {
+        globalContext()->setCurrentProject(notationProject);
+    }
 
     DEFER {
-        globalContext()->setCurrentProject(nullptr);
+        if (!isolated) {
+            globalContext()->setCurrentProject(nullptr);
+        }
     };
 
     // Check if this is a part conversion job
@@ -492,6 +887,10 @@ muse::Ret ConverterController::convertPage(INotationWriterPtr writer, INotationP
 
 Ret ConverterController::convertFullNotation(INotationWriterPtr writer, INotationPtr notation, const muse::io::path_t& out) const
 {
+    if (io::suffix(out) == PDF_SUFFIX) {
+        return streamToFile(writer, notation, out);
+    }
+
     auto outBuf = Buffer::opened(IODevice::WriteOnly);
 
     outBuf.setMeta("file_path", out.toStdString());
@@ -511,6 +910,37 @@ Ret ConverterController::convertFullNotation(INotationWriterPtr writer, INotatio
     return make_ret(Ret::Code::Ok);
 }
 
+Ret ConverterController::streamToFile(INotationWriterPtr writer, INotationPtr notation, const muse::io::path_t& out,
+                                      const INotationWriter::Options& options) const
+{
+    //! NOTE The writer writes straight to the file, so the whole document doesn't have to be kept in memory
+    FileStream outFile(out);
+    outFile.setMeta("file_path", out.toStdString());
+    if (!outFile.open(IODevice::WriteOnly)) {
+        LOGE() << "failed to open file: " << out;
+        return make_ret(Err::OutFileFailedWrite);
+    }
+
+    INotationWriter::Options streamOptions = options;
+    streamOptions[INotationWriter::OptionKey::STREAM_TO_DEVICE] = Val(true);
+
+    Ret ret = writer->write(notation, outFile, streamOptions);
+    outFile.close();
+
+    if (ret && outFile.hasError()) {
+        ret = make_ret(Ret::Code::UnknownError, outFile.errorString());
+    }
+
+    if (!ret) {
+        LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
+        //! NOTE Don't leave a truncated document behind
+        File::remove(out);
+        return make_ret(Err::OutFileFailedWrite);
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
 Ret ConverterController::convertScorePartsToPdf(INotationWriterPtr writer, IMasterNotationPtr masterNotation,
                                                 const muse::io::path_t& out) const
 {
@@ -525,18 +955,9 @@ Ret ConverterController::convertScorePartsToPdf(INotationWriterPtr writer, IMast
         QString baseName = QString::fromStdString(io::completeBasename(out).toStdString());
         muse::io::path_t partOut = io::dirpath(out) + "/" + baseName.replace("*", partName).toStdString() + ".pdf";
 
-        auto outBuf = Buffer::opened(IODevice::WriteOnly);
-        Ret ret = writer->write(e->notation(), outBuf, options);
-        if (!ret) {
-            LOGE() << "failed write, err: " << ret.toString() << ", path: " << partOut;
-            return make_ret(Err::OutFileFailedWrite);
-        }
-
-        outBuf.close();
-        ret = File::writeFile(partOut, outBuf.data());
+        Ret ret = streamToFile(writer, e->notation(), partOut, options);
         if (!ret) {
-            LOGE() << "failed to write file: " << ret.toString();
-            return make_ret(Err::OutFileFailedWrite);
+            return ret;
         }
     }
 
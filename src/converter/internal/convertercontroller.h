@@ -23,6 +23,8 @@
 
 #include <vector>
 
+#include <QJsonArray>
+
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
@@ -31,6 +33,7 @@
 #include "project/iprojectrwregister.h"
 #include "context/iglobalcontext.h"
 #include "extensions/iextensionsprovider.h"
+#include "engraving/iengravingfontsprovider.h"
 
 #include "types/retval.h"
 
@@ -40,6 +43,7 @@ class ConverterController : public IConverterController, public muse::Contextabl
     muse::GlobalInject<project::IProjectCreator> notationCreator;
     muse::GlobalInject<project::INotationWritersRegister> writers;
     muse::GlobalInject<project::IProjectRWRegister> projectRW;
+    muse::GlobalInject<engraving::IEngravingFontsProvider> engravingFonts;
     muse::ContextInject<context::IGlobalContext> globalContext = { this };
     muse::ContextInject<muse::extensions::IExtensionsProvider> extensionsProvider = { this };
 
@@ -53,7 +57,8 @@ public:
                           const std::optional<ConvertTarget>& target = std::nullopt) override;
 
     muse::Ret batchConvert(const muse::io::path_t& batchJobFile, const OpenParams& openParams = {}, const muse::String& soundProfile = {},
-                           const muse::UriQuery& extensionUri = {}, muse::ProgressPtr progress = nullptr) override;
+                           const muse::UriQuery& extensionUri = {}, muse::ProgressPtr progress = nullptr,
+                           size_t jobsCount = 1) override;
 
     muse::Ret convertScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {}) override;
 
@@ -90,15 +95,37 @@ private:
     };
 
     using BatchJob = std::vector<Job>;
+    using JobGroup = std::vector<size_t>; // indexes of the jobs converted from one loaded project
+    using GroupChain = std::vector<size_t>; // indexes of the job groups writing to a common output, converted in order
     using TransposeOpts = std::optional<notation::TransposeOptions>;
 
     muse::RetVal<BatchJob> parseBatchJob(const muse::io::path_t& batchJobFile) const;
+    std::vector<JobGroup> groupJobs(const BatchJob& batchJob, const muse::UriQuery& extensionUri) const;
+    bool canShareProject(const Job& job1, const Job& job2) const;
+    bool canWriteSameFile(const Job& job1, const Job& job2) const;
+    std::vector<GroupChain> chainGroups(const BatchJob& batchJob, const std::vector<JobGroup>& groups) const;
+    bool canConvertInParallel(const Job& job, const muse::String& soundProfile, const muse::UriQuery& extensionUri) const;
+    std::vector<muse::Ret> convertJobGroup(const BatchJob& batchJob, const JobGroup& group, const OpenParams& openParams,
+                                           const muse::String& soundProfile, const muse::UriQuery& extensionUri);
+    muse::RetVal<project::INotationProjectPtr> loadJobGroupProject(const BatchJob& batchJob, const JobGroup& group,
+                                                                   const OpenParams& openParams, const muse::String& soundProfile);
+    std::vector<muse::Ret> convertLoadedJobGroup(const BatchJob& batchJob, const JobGroup& group,
+                                                 const muse::RetVal<project::INotationProjectPtr>& project,
+                                                 const muse::UriQuery& extensionUri, bool isolated);
+
+    muse::RetVal<project::INotationProjectPtr> loadProject(const muse::io::path_t& in, const OpenParams& openParams,
+                                                           const muse::String& soundProfile, const TransposeOpts& transposeOptions,
+                                                           const std::vector<size_t>& visibleParts, const CopyrightInfo& copyright,
+                                                           QJsonArray* oldTracks = nullptr);
+    muse::Ret convertProject(project::INotationProjectPtr notationProject, const muse::io::path_t& out,
+                             const muse::UriQuery& extensionUri = {}, const std::optional<ConvertTarget>& target = std::nullopt,
+                             const muse::io::path_t& tracksDiffPath = {}, const QJsonArray& oldTracks = {}, bool isolated = false);
 
     muse::Ret convertFile(const muse::io::path_t& in, const muse::io::path_t& out, const OpenParams& openParams = {},
                           const muse::String& soundProfile = {}, const muse::io::path_t& tracksDiffPath = {},
                           const muse::UriQuery& extensionUri = {}, const TransposeOpts& transposeOptions = std::nullopt,
                           const std::optional<ConvertTarget>& target = std::nullopt, const std::vector<size_t>& visibleParts = {},
-                          const CopyrightInfo& copyright = {});
+                          const CopyrightInfo& copyright = {}, bool isolated = false);
 
     muse::Ret convertScoreParts(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                 const muse::io::path_t& out);
@@ -110,6 +137,8 @@ private:
     muse::Ret convertPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const size_t pageNum,
                           const muse::io::path_t& filePath, const muse::io::path_t& dirPath = {}) const;
     muse::Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out) const;
+    muse::Ret streamToFile(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out,
+                           const project::INotationWriter::Options& options = {}) const;
 
     muse::Ret convertScorePartsToPdf(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                      const muse::io::path_t& out) const;
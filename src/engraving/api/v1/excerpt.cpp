@@ -30,7 +30,7 @@
 using namespace mu::engraving::apiv1;
 Score* Excerpt::partScore()
 {
-    return wrap<mu::engraving::apiv1::Score>(e->excerptScore(), Ownership::SCORE);
+    return wrap<mu::engraving::apiv1::Score>(e->ensureExcerptLoaded(), Ownership::SCORE);
 }
 
 //---------------------------------------------------------
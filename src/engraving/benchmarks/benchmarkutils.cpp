@@ -0,0 +1,282 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "benchmarkutils.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+
+#include "global/io/file.h"
+
+#include "engraving/compat/mscxcompat.h"
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/dom/durationtype.h"
+#include "engraving/dom/instrument.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/mcursor.h"
+#include "engraving/dom/part.h"
+#include "engraving/dom/staff.h"
+#include "engraving/infrastructure/localfileinfoprovider.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace mu::engraving;
+
+std::map<std::string, JsonArray> BenchmarkUtils::s_results;
+
+//---------------------------------------------------------
+//   heap usage
+//    Every operator new allocation of the executable keeps
+//    its size in front of the block, so the bytes in use
+//    and their peak can be reported, and is counted
+//---------------------------------------------------------
+
+static constexpr size_t HEAP_HEADER_SIZE = alignof(std::max_align_t);
+static std::atomic<size_t> s_heapBytes = 0;
+static std::atomic<size_t> s_peakHeapBytes = 0;
+static std::atomic<size_t> s_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    void* block = std::malloc(size + HEAP_HEADER_SIZE);
+    if (!block) {
+        throw std::bad_alloc();
+    }
+
+    *static_cast<size_t*>(block) = size;
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    const size_t used = s_heapBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    size_t peak = s_peakHeapBytes.load(std::memory_order_relaxed);
+    while (used > peak && !s_peakHeapBytes.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {
+    }
+
+    return static_cast<char*>(block) + HEAP_HEADER_SIZE;
+}
+
+void operator delete(void* p) noexcept
+{
+    if (!p) {
+        return;
+    }
+
+    void* block = static_cast<char*>(p) - HEAP_HEADER_SIZE;
+    s_heapBytes.fetch_sub(*static_cast<size_t*>(block), std::memory_order_relaxed);
+    std::free(block);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    operator delete(p);
+}
+
+size_t BenchmarkUtils::resetPeakHeapBytes()
+{
+    const size_t used = s_heapBytes.load(std::memory_order_relaxed);
+    s_peakHeapBytes.store(used, std::memory_order_relaxed);
+    return used;
+}
+
+size_t BenchmarkUtils::peakHeapBytes()
+{
+    return s_peakHeapBytes.load(std::memory_order_relaxed);
+}
+
+size_t BenchmarkUtils::allocationCount()
+{
+    return s_allocations.load(std::memory_order_relaxed);
+}
+
+static const modularity::ContextPtr benchmarkCtx = std::make_shared<modularity::Context>(1);
+
+static const char* envValue(const char* name)
+{
+    const char* value = std::getenv(name);
+    return (value && *value) ? value : nullptr;
+}
+
+int BenchmarkUtils::iterations()
+{
+    static const int ITERATIONS = []() {
+        const char* value = envValue("ENGRAVING_BENCHMARKS_ITERATIONS");
+        return value ? std::max(1, std::atoi(value)) : 3;
+    }();
+
+    return ITERATIONS;
+}
+
+//---------------------------------------------------------
+//   corpusFiles
+//    The vtest scores, or the scores of the directory given
+//    by ENGRAVING_BENCHMARKS_SCORES
+//---------------------------------------------------------
+
+io::paths_t BenchmarkUtils::corpusFiles()
+{
+    const char* dir = envValue("ENGRAVING_BENCHMARKS_SCORES");
+    const std::filesystem::path root = dir ? dir : ENGRAVING_BENCHMARKS_SCORES_DIR;
+
+    std::error_code ec;
+    std::vector<std::filesystem::path> paths;
+    for (const auto& entry : std::filesystem::directory_iterator(root, ec)) {
+        const std::filesystem::path& path = entry.path();
+        if (path.extension() == ".mscx" || path.extension() == ".mscz") {
+            paths.push_back(path);
+        }
+    }
+
+    if (ec) {
+        LOGE() << "can't read scores directory: " << root.string() << ", error: " << ec.message();
+    }
+
+    std::sort(paths.begin(), paths.end());
+
+    io::paths_t files;
+    for (const std::filesystem::path& path : paths) {
+        files.push_back(io::path_t(path.string()));
+    }
+    return files;
+}
+
+//---------------------------------------------------------
+//   loadScore
+//    Reads the score without laying it out
+//---------------------------------------------------------
+
+MasterScore* BenchmarkUtils::loadScore(const io::path_t& path)
+{
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle(benchmarkCtx);
+    score->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>(path));
+
+    Ret ret = compat::loadMsczOrMscx(score, path, true);
+    if (!ret) {
+        LOGW() << "can't load score, path: " << path << ", error: " << ret.toString();
+        delete score;
+        return nullptr;
+    }
+
+    return score;
+}
+
+//---------------------------------------------------------
+//   generateScore
+//---------------------------------------------------------
+
+MasterScore* BenchmarkUtils::generateScore(const GeneratedScoreParams& params)
+{
+    MCursor c;
+    c.setTimeSig(Fraction(4, 4));
+    c.createScore(benchmarkCtx, String::fromStdString(params.name));
+    for (const String& instrument : params.instruments) {
+        c.addPart(instrument);
+    }
+
+    c.move(0, Fraction(0, 1));
+    c.addKeySig(Key::C);
+    c.addTimeSig(Fraction(4, 4));
+
+    MasterScore* score = c.score();
+    const TDuration duration(params.noteDuration);
+    const Fraction end = Fraction(params.measures * 4, 4);
+
+    for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        const Instrument* instrument = score->staff(staffIdx)->part()->instrument();
+        const int lowest = instrument->minPitchA();
+        const int range = std::max(1, std::min(instrument->maxPitchA() - lowest, 24));
+
+        c.move(static_cast<int>(staffIdx * VOICES), Fraction(0, 1));
+        int step = 0;
+        for (Fraction tick(0, 1); tick < end; tick += duration.fraction()) {
+            // walk up and down the range so that beams, stems and ledger lines vary
+            c.addChord(lowest + (step * 5) % range, duration);
+            ++step;
+        }
+    }
+
+    score->setUpTempoMapLater();
+    score->setLayoutAll();
+    return score;
+}
+
+//---------------------------------------------------------
+//   orchestraInstruments
+//    60 single staff instruments
+//---------------------------------------------------------
+
+std::vector<String> BenchmarkUtils::orchestraInstruments()
+{
+    const std::vector<std::pair<String, int> > sections = {
+        { u"flute", 3 }, { u"oboe", 3 }, { u"clarinet", 3 }, { u"bassoon", 3 },
+        { u"horn", 6 }, { u"trumpet", 4 }, { u"trombone", 3 }, { u"tuba", 1 }, { u"timpani", 1 },
+        { u"violin", 13 }, { u"viola", 8 }, { u"violoncello", 8 }, { u"contrabass", 4 }
+    };
+
+    std::vector<String> instruments;
+    for (const auto& section : sections) {
+        instruments.insert(instruments.end(), section.second, section.first);
+    }
+    return instruments;
+}
+
+//---------------------------------------------------------
+//   addResult
+//---------------------------------------------------------
+
+void BenchmarkUtils::addResult(const std::string& group, const JsonObject& result)
+{
+    s_results[group] << result;
+}
+
+//---------------------------------------------------------
+//   writeReport
+//    Writes all results as JSON to the file given by
+//    ENGRAVING_BENCHMARKS_OUTPUT
+//---------------------------------------------------------
+
+Ret BenchmarkUtils::writeReport()
+{
+    if (s_results.empty()) {
+        return make_ok();
+    }
+
+    JsonObject root;
+    root["iterations"] = iterations();
+    for (const auto& pair : s_results) {
+        root[pair.first] = pair.second;
+    }
+
+    const char* output = envValue("ENGRAVING_BENCHMARKS_OUTPUT");
+    const io::path_t path = output ? output : "engraving_benchmarks.json";
+
+    Ret ret = io::File::writeFile(path, JsonDocument(root).toJson());
+    if (ret) {
+        LOGI() << "benchmark results written to: " << path;
+    } else {
+        LOGE() << "can't write benchmark results to: " << path << ", error: " << ret.toString();
+    }
+
+    return ret;
+}
@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "global/io/path.h"
+#include "global/serialization/json.h"
+#include "global/types/ret.h"
+
+#include "engraving/types/types.h"
+
+namespace mu::engraving {
+class MasterScore;
+
+//---------------------------------------------------------
+//   GeneratedScoreParams
+//    Describes a score built in memory: one single staff
+//    part per instrument, every staff filled with notes
+//    of the given duration
+//---------------------------------------------------------
+
+struct GeneratedScoreParams {
+    std::string name;
+    std::vector<String> instruments;
+    int measures = 0;
+    DurationType noteDuration = DurationType::V_QUARTER;
+};
+
+class BenchmarkUtils
+{
+public:
+    static int iterations();
+
+    static muse::io::paths_t corpusFiles();
+    static MasterScore* loadScore(const muse::io::path_t& path);
+    static MasterScore* generateScore(const GeneratedScoreParams& params);
+    static std::vector<String> orchestraInstruments();
+
+    //! NOTE Returns the median duration of the runs in milliseconds
+    template<typename Func>
+    static double measureMs(Func func)
+    {
+        std::vector<double> durations;
+        const int runs = iterations();
+        for (int i = 0; i < runs; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            func();
+            durations.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        std::sort(durations.begin(), durations.end());
+        return durations.empty() ? 0.0 : durations.at(durations.size() / 2);
+    }
+
+    //! NOTE Returns the highest heap usage (memory allocated with operator new)
+    //! while func runs in bytes, above the usage before
+    template<typename Func>
+    static size_t measurePeakHeapBytes(Func func)
+    {
+        const size_t before = resetPeakHeapBytes();
+        func();
+        return peakHeapBytes() - before;
+    }
+
+    //! NOTE Returns the number of operator new allocations while func runs
+    template<typename Func>
+    static size_t measureAllocations(Func func)
+    {
+        const size_t before = allocationCount();
+        func();
+        return allocationCount() - before;
+    }
+
+    static size_t resetPeakHeapBytes();
+    static size_t peakHeapBytes();
+    static size_t allocationCount();
+
+    static void addResult(const std::string& group, const muse::JsonObject& result);
+    static muse::Ret writeReport();
+
+private:
+    static std::map<std::string, muse::JsonArray> s_results;
+};
+}
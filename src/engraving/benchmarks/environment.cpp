@@ -0,0 +1,53 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/environment.h"
+
+#include "draw/drawmodule.h"
+#include "engraving/engravingmodule.h"
+
+#include "engraving/dom/instrtemplate.h"
+#include "engraving/dom/mscore.h"
+
+#include "benchmarkutils.h"
+
+#include "log.h"
+
+static muse::testing::SuiteEnvironment engraving_benchmarks_se(
+{
+    new muse::draw::DrawModule(),
+    new mu::engraving::EngravingModule()
+},
+    nullptr,
+    []() {
+    LOGI() << "engraving benchmarks suite post init";
+
+    mu::engraving::MScore::testMode = true;
+    mu::engraving::MScore::noGui = true;
+
+    mu::engraving::loadInstrumentTemplates(":/engraving/instruments/instruments.xml");
+},
+
+    []() {
+    mu::engraving::BenchmarkUtils::writeReport();
+}
+    );
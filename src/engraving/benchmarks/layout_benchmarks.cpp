@@ -0,0 +1,158 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "global/io/buffer.h"
+#include "global/io/file.h"
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/measure.h"
+#include "engraving/rw/rwregister.h"
+
+#include "benchmarkutils.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   Engraving_LayoutBenchmarks
+//    Not a correctness test: every benchmark records its
+//    timings, which are written as JSON when the suite ends
+//    (see BenchmarkUtils::writeReport)
+//---------------------------------------------------------
+
+class Engraving_LayoutBenchmarks : public ::testing::Test
+{
+public:
+    JsonObject benchmarkScore(MasterScore* score, const std::string& name);
+};
+
+static const Measure* middleMeasure(const MasterScore* score)
+{
+    const Measure* measure = score->firstMeasure();
+    for (size_t i = 0; measure && i < score->nmeasures() / 2; ++i) {
+        measure = measure->nextMeasure();
+    }
+    return measure;
+}
+
+//---------------------------------------------------------
+//   benchmarkScore
+//    full layout in page view and continuous view,
+//    relayout of a single measure, save and load
+//---------------------------------------------------------
+
+JsonObject Engraving_LayoutBenchmarks::benchmarkScore(MasterScore* score, const std::string& name)
+{
+    JsonObject result;
+    result["name"] = name;
+
+    result["fullLayoutMs"] = BenchmarkUtils::measureMs([score]() {
+        score->setLayoutAll();
+        score->doLayout();
+    });
+
+    result["fullLayoutAllocations"] = static_cast<double>(BenchmarkUtils::measureAllocations([score]() {
+        score->setLayoutAll();
+        score->doLayout();
+    }));
+
+    result["staves"] = static_cast<int>(score->nstaves());
+    result["measures"] = static_cast<int>(score->nmeasures());
+    result["pages"] = static_cast<int>(score->npages());
+
+    // what an edit in the middle of the score costs
+    if (const Measure* measure = middleMeasure(score)) {
+        const Fraction startTick = measure->tick();
+        const Fraction endTick = measure->endTick();
+        result["measureRelayoutMs"] = BenchmarkUtils::measureMs([score, startTick, endTick]() {
+            score->doLayoutRange(startTick, endTick);
+        });
+    }
+
+    score->setLayoutMode(LayoutMode::LINE);
+    result["continuousLayoutMs"] = BenchmarkUtils::measureMs([score]() {
+        score->setLayoutAll();
+        score->doLayout();
+    });
+    score->setLayoutMode(LayoutMode::PAGE);
+    score->doLayout();
+
+    ByteArray data;
+    result["saveMs"] = BenchmarkUtils::measureMs([score, &data]() {
+        auto buffer = io::Buffer::opened(io::IODevice::WriteOnly);
+        rw::RWRegister::writer()->writeScore(score, &buffer);
+        data = buffer.data();
+    });
+
+    const io::path_t path = (std::filesystem::temp_directory_path() / "engraving_benchmark.mscx").string();
+    if (io::File::writeFile(path, data)) {
+        result["loadMs"] = BenchmarkUtils::measureMs([&path]() {
+            delete BenchmarkUtils::loadScore(path);
+        });
+        io::File::remove(path);
+    }
+
+    return result;
+}
+
+TEST_F(Engraving_LayoutBenchmarks, vtestScores)
+{
+    const io::paths_t files = BenchmarkUtils::corpusFiles();
+    ASSERT_FALSE(files.empty());
+
+    for (const io::path_t& path : files) {
+        MasterScore* score = BenchmarkUtils::loadScore(path);
+        if (!score) {
+            continue;
+        }
+
+        BenchmarkUtils::addResult("vtestScores", benchmarkScore(score, io::filename(path).toStdString()));
+        delete score;
+    }
+}
+
+TEST_F(Engraving_LayoutBenchmarks, generatedScores)
+{
+    const std::vector<String> orchestra = BenchmarkUtils::orchestraInstruments();
+    const std::vector<String> strings(orchestra.end() - 16, orchestra.end());
+
+    const std::vector<GeneratedScoreParams> scores = {
+        { "orchestra_60x500", orchestra, 500, DurationType::V_QUARTER },
+        { "strings_16x200_sixteenths", strings, 200, DurationType::V_16TH },
+        { "solo_1x2000", { u"flute" }, 2000, DurationType::V_EIGHTH },
+    };
+
+    for (const GeneratedScoreParams& params : scores) {
+        MasterScore* score = BenchmarkUtils::generateScore(params);
+        ASSERT_TRUE(score);
+        EXPECT_EQ(score->nstaves(), params.instruments.size());
+
+        BenchmarkUtils::addResult("generatedScores", benchmarkScore(score, params.name));
+        delete score;
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "engraving/compat/midi/compatmidirender.h"
+#include "engraving/compat/midi/event.h"
+#include "engraving/dom/masterscore.h"
+
+#include "benchmarkutils.h"
+
+using namespace muse;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   Engraving_MidiBenchmarks
+//    Rendering of the MIDI events, as done by the MIDI
+//    export, with its time and peak heap usage
+//---------------------------------------------------------
+
+class Engraving_MidiBenchmarks : public ::testing::Test
+{
+public:
+    JsonObject benchmarkScore(MasterScore* score, const std::string& name);
+};
+
+static size_t renderEvents(MasterScore* score)
+{
+    EventsHolder events;
+    CompatMidiRendererInternal::Context context;
+    context.applyCaesuras = true;
+
+    CompatMidiRender::renderScore(score, events, context, true);
+
+    size_t count = 0;
+    for (size_t channel = 0; channel < events.size(); ++channel) {
+        count += events[channel].size();
+    }
+    return count;
+}
+
+JsonObject Engraving_MidiBenchmarks::benchmarkScore(MasterScore* score, const std::string& name)
+{
+    JsonObject result;
+    result["name"] = name;
+    result["staves"] = static_cast<int>(score->nstaves());
+    result["measures"] = static_cast<int>(score->nmeasures());
+
+    size_t events = 0;
+    result["renderMs"] = BenchmarkUtils::measureMs([score, &events]() {
+        events = renderEvents(score);
+    });
+
+    const size_t peakBytes = BenchmarkUtils::measurePeakHeapBytes([score]() {
+        renderEvents(score);
+    });
+
+    result["events"] = static_cast<int>(events);
+    result["peakHeapMB"] = static_cast<double>(peakBytes) / (1024.0 * 1024.0);
+
+    return result;
+}
+
+TEST_F(Engraving_MidiBenchmarks, vtestScores)
+{
+    const io::paths_t files = BenchmarkUtils::corpusFiles();
+    ASSERT_FALSE(files.empty());
+
+    for (const io::path_t& path : files) {
+        MasterScore* score = BenchmarkUtils::loadScore(path);
+        if (!score) {
+            continue;
+        }
+
+        score->doLayout();
+        BenchmarkUtils::addResult("midiVtestScores", benchmarkScore(score, io::filename(path).toStdString()));
+        delete score;
+    }
+}
+
+TEST_F(Engraving_MidiBenchmarks, generatedScores)
+{
+    const std::vector<String> orchestra = BenchmarkUtils::orchestraInstruments();
+    const std::vector<String> strings(orchestra.end() - 16, orchestra.end());
+
+    const std::vector<GeneratedScoreParams> scores = {
+        { "orchestra_60x1000_eighths", orchestra, 1000, DurationType::V_EIGHTH },
+        { "strings_16x500_sixteenths", strings, 500, DurationType::V_16TH },
+        { "solo_1x2000", { u"flute" }, 2000, DurationType::V_EIGHTH },
+    };
+
+    for (const GeneratedScoreParams& params : scores) {
+        MasterScore* score = BenchmarkUtils::generateScore(params);
+        ASSERT_TRUE(score);
+
+        score->doLayout();
+        BenchmarkUtils::addResult("midiGeneratedScores", benchmarkScore(score, params.name));
+        delete score;
+    }
+}
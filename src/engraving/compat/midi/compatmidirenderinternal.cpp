@@ -30,6 +30,12 @@
 
 #include <cmath>
 
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include "infrastructure/parallelfor.h"
+#endif
+
 #include "compat/midi/event.h"
 #include "types/constants.h"
 
@@ -1131,18 +1137,20 @@ bool shouldPlayHammerOn(const Chord* chord)
         firstTiedChord = firstTiedChord->nextTiedChord(true, false);
     }
 
-    for (auto it : score->spannerMap().findOverlapping(currentTick, currentTick + chord->ticks().ticks())) {
-        Spanner* spanner = it.value;
+    bool playHammerOn = false;
+    score->spannerMap().visitOverlapping(currentTick, currentTick + chord->ticks().ticks(),
+                                         [chord, &playHammerOn](const interval_tree::Interval<Spanner*>& interval) {
+        Spanner* spanner = interval.value;
         if (spanner->track() != chord->track()) {
-            continue;
+            return;
         }
 
         if (spanner->isHammerOnPullOff() && (spanner->startChord() != chord)) {
-            return true;
+            playHammerOn = true;
         }
-    }
+    });
 
-    return false;
+    return playHammerOn;
 }
 
 CompatMidiRendererInternal::ChordParams CompatMidiRendererInternal::collectChordParams(const Chord* chord, int tickOffset) const
@@ -1150,10 +1158,11 @@ CompatMidiRendererInternal::ChordParams CompatMidiRendererInternal::collectChord
     ChordParams chordParams;
 
     int currentTick = chord->tick().ticks();
-    for (auto it : score->spannerMap().findOverlapping(currentTick + 1, currentTick + 2)) {
-        Spanner* spanner = it.value;
+    score->spannerMap().visitOverlapping(currentTick + 1, currentTick + 2,
+                                         [chord, tickOffset, &chordParams](const interval_tree::Interval<Spanner*>& interval) {
+        Spanner* spanner = interval.value;
         if (spanner->track() != chord->track()) {
-            continue;
+            return;
         }
 
         if (spanner->isLetRing()) {
@@ -1164,7 +1173,7 @@ CompatMidiRendererInternal::ChordParams CompatMidiRendererInternal::collectChord
         } else if (spanner->isPalmMute()) {
             chordParams.palmMute = true;
         }
-    }
+    });
 
     chordParams.hammerOnPullOff = shouldPlayHammerOn(chord);
     return chordParams;
@@ -1336,6 +1345,63 @@ void CompatMidiRendererInternal::renderStaff(EventsHolder& events, const Staff*
     }
 }
 
+//---------------------------------------------------------
+//   renderStaves
+//    With parallelMidiRendering() every staff is rendered
+//    into its own events and pitch wheel functions, which
+//    are appended in staff order afterwards. This gives the
+//    same events in the same order as rendering the staves
+//    one after another.
+//---------------------------------------------------------
+
+void CompatMidiRendererInternal::renderStaves(EventsHolder& events, PitchWheelRenderer& pitchWheelRenderer)
+{
+    const std::vector<Staff*>& staves = score->staves();
+
+#ifdef MUSE_THREADS_SUPPORT
+    if (staves.size() > 1 && canRenderStavesInParallel()) {
+        // update the lazily built lookups before, so the workers only read them
+        score->repeatList();
+        score->spannerMap().flush();
+
+        std::vector<EventsHolder> staffEvents(staves.size());
+        std::vector<PitchWheelRenderer> staffPitchWheels(staves.size(), PitchWheelRenderer(g_wheelSpec));
+
+        parallelFor(staves.size(), [this, &staves, &staffEvents, &staffPitchWheels](size_t idx) {
+            renderStaff(staffEvents.at(idx), staves.at(idx), staffPitchWheels.at(idx));
+        });
+
+        for (size_t idx = 0; idx < staves.size(); ++idx) {
+            events.append(staffEvents.at(idx));
+            pitchWheelRenderer.append(std::move(staffPitchWheels.at(idx)));
+        }
+
+        return;
+    }
+#endif
+
+    for (const Staff* st : staves) {
+        renderStaff(events, st, pitchWheelRenderer);
+    }
+}
+
+//---------------------------------------------------------
+//   canRenderStavesInParallel
+//    Channels looked up for string, effect or harmony are
+//    numbered in the order they are first used, which only
+//    the serial rendering keeps
+//---------------------------------------------------------
+
+bool CompatMidiRendererInternal::canRenderStavesInParallel() const
+{
+    if (!configuration() || !configuration()->parallelMidiRendering()) {
+        return false;
+    }
+
+    return !m_context.eachStringHasChannel && !m_context.instrumentsHaveEffects
+           && m_context.harmonyChannelSetting != HarmonyChannelSetting::LOOKUP;
+}
+
 //---------------------------------------------------------
 //   renderSpanners
 //---------------------------------------------------------
@@ -1527,21 +1593,22 @@ void CompatMidiRendererInternal::doRenderSpanners(EventsHolder& events, Spanner*
 
 static Trill* findFirstTrill(Chord* chord)
 {
-    auto spanners = chord->score()->spannerMap().findOverlapping(1 + chord->tick().ticks(), chord->endTick().ticks() - 1);
-    for (auto i : spanners) {
-        if (!i.value->isTrill()) {
-            continue;
+    Trill* firstTrill = nullptr;
+    chord->score()->spannerMap().visitOverlapping(1 + chord->tick().ticks(), chord->endTick().ticks() - 1,
+                                                  [chord, &firstTrill](const interval_tree::Interval<Spanner*>& interval) {
+        if (firstTrill || !interval.value->isTrill()) {
+            return;
         }
-        if (i.value->track() != chord->track()) {
-            continue;
+        if (interval.value->track() != chord->track()) {
+            return;
         }
-        Trill* trill = toTrill(i.value);
+        Trill* trill = toTrill(interval.value);
         if (!trill->playSpanner()) {
-            continue;
+            return;
         }
-        return trill;
-    }
-    return nullptr;
+        firstTrill = trill;
+    });
+    return firstTrill;
 }
 
 void CompatMidiRendererInternal::renderScore(EventsHolder& events, const Context& context, bool expandRepeats)
@@ -1564,9 +1631,7 @@ void CompatMidiRendererInternal::renderScore(EventsHolder& events, const Context
     fillScoreVelocities(score, m_context);
 
     // create note & other events
-    for (const Staff* st : score->staves()) {
-        renderStaff(events, st, pitchWheelRender);
-    }
+    renderStaves(events, pitchWheelRender);
     events.fixupMIDI();
 
     // create sustain pedal events
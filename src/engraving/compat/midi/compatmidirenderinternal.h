@@ -25,8 +25,11 @@
 
 #include <memory>
 
+#include "global/modularity/ioc.h"
+
 #include "../../dom/measure.h"
 #include "../../dom/mscore.h"
+#include "../../iengravingconfiguration.h"
 #include "../../types/types.h"
 
 #include "pitchwheelrenderer.h"
@@ -121,6 +124,8 @@ static const std::vector<OrnamentExcursion> excursions = {
 
 class CompatMidiRendererInternal
 {
+    muse::GlobalInject<IEngravingConfiguration> configuration;
+
 public:
 
     //! @brief helper structure to find channel
@@ -184,6 +189,8 @@ public:
 private:
 
     void renderStaff(EventsHolder& events, const Staff* sctx, PitchWheelRenderer& pitchWheelRenderer);
+    void renderStaves(EventsHolder& events, PitchWheelRenderer& pitchWheelRenderer);
+    bool canRenderStavesInParallel() const;
 
     void renderSpanners(EventsHolder& events, PitchWheelRenderer& pitchWheelRenderer);
     void doRenderSpanners(EventsHolder& events, Spanner* s, uint32_t channel, PitchWheelRenderer& pitchWheelRenderer,
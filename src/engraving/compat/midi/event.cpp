@@ -22,6 +22,9 @@
 
 #include "event.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "dom/note.h"
 #include "dom/sig.h"
 
@@ -200,7 +203,114 @@ void EventList::insert(const Event& e)
     push_back(e);
 }
 
-EventsHolder::events_multimap_t& EventsHolder::operator[](std::size_t idx)
+//---------------------------------------------------------
+//   ChannelEvents
+//---------------------------------------------------------
+
+static bool tickLess(const ChannelEvents::value_type& event1, const ChannelEvents::value_type& event2)
+{
+    return event1.first < event2.first;
+}
+
+static bool tickLessThan(const ChannelEvents::value_type& event, int tick)
+{
+    return event.first < tick;
+}
+
+void ChannelEvents::clear()
+{
+    m_events.clear();
+    m_sortedCount = 0;
+}
+
+void ChannelEvents::merge(ChannelEvents& other)
+{
+    if (m_events.empty()) {
+        m_events.swap(other.m_events);
+        m_sortedCount = other.m_sortedCount;
+    } else {
+        m_events.insert(m_events.end(), std::make_move_iterator(other.m_events.begin()),
+                        std::make_move_iterator(other.m_events.end()));
+    }
+
+    other.clear();
+}
+
+//---------------------------------------------------------
+//   sort
+//    Events are mostly added in tick order, so usually
+//    checking the new events is all that is needed
+//---------------------------------------------------------
+
+void ChannelEvents::sort() const
+{
+    if (m_sortedCount == m_events.size()) {
+        return;
+    }
+
+    auto tail = m_events.begin() + m_sortedCount;
+    if (!std::is_sorted(tail, m_events.end(), tickLess)) {
+        std::stable_sort(tail, m_events.end(), tickLess);
+    }
+
+    if (m_sortedCount > 0 && tail->first < std::prev(tail)->first) {
+        std::inplace_merge(m_events.begin(), tail, m_events.end(), tickLess);
+    }
+
+    m_sortedCount = m_events.size();
+}
+
+ChannelEvents::iterator ChannelEvents::lower_bound(int tick)
+{
+    return std::lower_bound(begin(), end(), tick, tickLessThan);
+}
+
+ChannelEvents::const_iterator ChannelEvents::lower_bound(int tick) const
+{
+    return std::lower_bound(begin(), end(), tick, tickLessThan);
+}
+
+ChannelEvents::iterator ChannelEvents::find(int tick)
+{
+    auto it = lower_bound(tick);
+    return (it != end() && it->first == tick) ? it : end();
+}
+
+ChannelEvents::const_iterator ChannelEvents::find(int tick) const
+{
+    auto it = lower_bound(tick);
+    return (it != end() && it->first == tick) ? it : end();
+}
+
+ChannelEvents::const_iterator ChannelEvents::findLess(int tick) const
+{
+    auto it = lower_bound(tick);
+    return it == begin() ? end() : std::prev(it);
+}
+
+size_t ChannelEvents::count(int tick) const
+{
+    auto it = lower_bound(tick);
+    size_t result = 0;
+    for (; it != end() && it->first == tick; ++it) {
+        ++result;
+    }
+    return result;
+}
+
+ChannelEvents::iterator ChannelEvents::erase(iterator it)
+{
+    if (static_cast<size_t>(it - m_events.begin()) < m_sortedCount) {
+        --m_sortedCount;
+    }
+    return m_events.erase(it);
+}
+
+//---------------------------------------------------------
+//   EventsHolder
+//---------------------------------------------------------
+
+ChannelEvents& EventsHolder::operator[](std::size_t idx)
 {
     if (size() == 0) {
         _channels.emplace_back();
@@ -214,7 +324,7 @@ EventsHolder::events_multimap_t& EventsHolder::operator[](std::size_t idx)
     return _channels[idx];
 }
 
-const EventsHolder::events_multimap_t& EventsHolder::operator[](std::size_t idx) const
+const ChannelEvents& EventsHolder::operator[](std::size_t idx) const
 {
     // Since EventsHolder acts more like a vector
     // Using const subscript operator for a nonexistent element is UB
@@ -227,17 +337,29 @@ const EventsHolder::events_multimap_t& EventsHolder::operator[](std::size_t idx)
     return _channels[idx];
 }
 
+//---------------------------------------------------------
+//   mergePitchWheelEvents
+//    The pitch wheel resets are collected first and added
+//    together with the pitch wheel events, so every channel
+//    is sorted once
+//---------------------------------------------------------
+
 void EventsHolder::mergePitchWheelEvents(EventsHolder& pitchWheelEvents)
 {
+    PitchWheelSpecs specs;
+    ChannelEvents pwResets;
+
     for (size_t i = 0; i < size(); ++i) {
-        for (const auto& eventPair : _channels[i]) {
-            const auto& event = eventPair.second;
-            const auto& tick = eventPair.first;
+        const ChannelEvents& channelPitchWheelEvents = pitchWheelEvents[i];
+        if (channelPitchWheelEvents.empty()) {
+            continue;
+        }
+
+        for (const auto& [tick, event] : std::as_const(_channels[i])) {
             if (event.type() == ME_NOTEON && event.velo() != 0) {
-                const auto& pwEvent = muse::findLess(pitchWheelEvents[i], tick);
-                if (pwEvent != pitchWheelEvents[i].end()
+                const auto pwEvent = channelPitchWheelEvents.findLess(tick);
+                if (pwEvent != channelPitchWheelEvents.end()
                     && pwEvent->second.type() == ME_PITCHBEND) {
-                    PitchWheelSpecs specs;
                     NPlayEvent pwReset(ME_PITCHBEND, (uint8_t)i, specs.mLimit % 128, specs.mLimit / 128);
                     pwReset.setOriginatingStaff(pwEvent->second.getOriginatingStaff());
 
@@ -248,14 +370,34 @@ void EventsHolder::mergePitchWheelEvents(EventsHolder& pitchWheelEvents)
                         tickForPwReset = (tick + pwEvent->first) / 2;
                     }
 
-                    _channels[i].insert(std::pair<int, NPlayEvent>(tickForPwReset, pwReset));
+                    pwResets.emplace(tickForPwReset, pwReset);
                 }
             }
         }
+
+        _channels[i].merge(pwResets);
         _channels[i].merge(pitchWheelEvents[i]);
     }
 }
 
+//---------------------------------------------------------
+//   append
+//    Moves the events of other behind the events with the
+//    same tick, as if they were emplaced after them
+//---------------------------------------------------------
+
+void EventsHolder::append(EventsHolder& other)
+{
+    if (other.size() == 0) {
+        return;
+    }
+
+    (*this)[other.size() - 1];
+    for (size_t i = 0; i < other.size(); ++i) {
+        _channels[i].merge(other._channels[i]);
+    }
+}
+
 //---------------------------------------------------------
 //   class EventsHolder::fixupMIDI
 //---------------------------------------------------------
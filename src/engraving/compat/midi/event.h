@@ -24,6 +24,7 @@
 #define MU_ENGRAVING_COMPAT_EVENT_H
 
 #include <map>
+#include <utility>
 #include <vector>
 
 #include "midiinstrumenteffects.h"
@@ -175,17 +176,70 @@ public:
     void insertNote(int channel, Note*);
 };
 
+//---------------------------------------------------------
+//   ChannelEvents
+//    The events of a channel ordered by tick, events with
+//    the same tick in the order they were added (like a
+//    std::multimap<int, NPlayEvent>).
+//    Events are appended to a flat vector. The unsorted
+//    tail is sorted and merged into the rest on the first
+//    read access, so reading isn't thread-safe either.
+//---------------------------------------------------------
+
+class ChannelEvents
+{
+public:
+    using value_type = std::pair<int, NPlayEvent>;
+    using container_type = std::vector<value_type>;
+    using iterator = container_type::iterator;
+    using const_iterator = container_type::const_iterator;
+
+    [[nodiscard]] size_t size() const { return m_events.size(); }
+    [[nodiscard]] bool empty() const { return m_events.empty(); }
+    void reserve(size_t count) { m_events.reserve(count); }
+    void clear();
+
+    void emplace(int tick, const NPlayEvent& event) { m_events.emplace_back(tick, event); }
+    void insert(const value_type& value) { m_events.push_back(value); }
+
+    // Adds the events of other after the ones with the same tick, other is left empty
+    void merge(ChannelEvents& other);
+
+    iterator begin() { sort(); return m_events.begin(); }
+    iterator end() { sort(); return m_events.end(); }
+    const_iterator begin() const { sort(); return m_events.cbegin(); }
+    const_iterator end() const { sort(); return m_events.cend(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    iterator lower_bound(int tick);
+    const_iterator lower_bound(int tick) const;
+    iterator find(int tick);
+    const_iterator find(int tick) const;
+    // the last event before tick, or end()
+    const_iterator findLess(int tick) const;
+    size_t count(int tick) const;
+
+    iterator erase(iterator it);
+
+private:
+    void sort() const;
+
+    mutable container_type m_events;
+    mutable size_t m_sortedCount = 0;
+};
+
 class EventsHolder
 {
     OBJECT_ALLOCATOR(engraving, EventsHolder)
 
-    using events_multimap_t = std::multimap<int, NPlayEvent>;
-    std::vector<events_multimap_t> _channels;
+    std::vector<ChannelEvents> _channels;
 public:
     [[nodiscard]] size_t size() const { return _channels.size(); }
-    events_multimap_t& operator[](std::size_t idx);
-    const events_multimap_t& operator[](std::size_t idx) const;
+    ChannelEvents& operator[](std::size_t idx);
+    const ChannelEvents& operator[](std::size_t idx) const;
     void mergePitchWheelEvents(EventsHolder& pitchWheelEvents);
+    void append(EventsHolder& other);
     void fixupMIDI();
 };
 
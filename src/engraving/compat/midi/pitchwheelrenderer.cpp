@@ -1,5 +1,8 @@
 #include "pitchwheelrenderer.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "log.h"
 
 using namespace mu::engraving;
@@ -25,6 +28,29 @@ void PitchWheelRenderer::addPitchWheelFunction(const PitchWheelFunction& functio
     functions.functions.push_back(function);
 }
 
+void PitchWheelRenderer::append(PitchWheelRenderer&& other)
+{
+    for (auto& [channel, otherFunctions] : other._functions) {
+        PitchWheelFunctions& functions = _functions[channel];
+        functions.startTick = std::min(functions.startTick, otherFunctions.startTick);
+        functions.endTick = std::max(functions.endTick, otherFunctions.endTick);
+
+        functions.functions.insert(functions.functions.end(),
+                                   std::make_move_iterator(otherFunctions.functions.begin()),
+                                   std::make_move_iterator(otherFunctions.functions.end()));
+    }
+
+    for (const auto& [channel, effect] : other._effectByChannel) {
+        _effectByChannel[channel] = effect;
+    }
+
+    for (const auto& [channel, staffIdx] : other._staffIdxByChannel) {
+        _staffIdxByChannel[channel] = staffIdx;
+    }
+
+    other._functions.clear();
+}
+
 EventsHolder PitchWheelRenderer::renderPitchWheel() const noexcept
 {
     EventsHolder pitchWheelEvents;
@@ -110,7 +136,7 @@ void PitchWheelRenderer::renderChannelPitchWheel(EventsHolder& pitchWheelEvents,
                 if (staffInfoValid) {
                     evb.setOriginatingStaff(staffIdx);
                 }
-                pitchWheelEvents[channel].emplace_hint(pitchWheelEvents[channel].end(), std::make_pair(tick, evb));
+                pitchWheelEvents[channel].emplace(tick, evb);
                 forceUpdate = false;
             }
 
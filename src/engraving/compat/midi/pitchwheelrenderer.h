@@ -45,6 +45,9 @@ public:
 
     void addPitchWheelFunction(const PitchWheelFunction& function, uint32_t channel, staff_idx_t staffIdx, MidiInstrumentEffect effect);
 
+    //! NOTE Same result as adding the functions of other after the ones of this renderer
+    void append(PitchWheelRenderer&& other);
+
     EventsHolder renderPitchWheel() const noexcept;
 
     static void generateRanges(const std::vector<PitchWheelFunction>& functions, std::map<int, int, std::greater<> >& ranges);
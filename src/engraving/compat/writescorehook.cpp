@@ -62,8 +62,8 @@ void WriteScoreHook::onWriteExcerpts302(Score* score, XmlWriter& xml, WriteConte
 
     if (isWriteExcerpts && score->isMaster() && !ctx.shouldWriteRange()) {
         MasterScore* mScore = static_cast<MasterScore*>(score);
-        for (const Excerpt* excerpt : mScore->excerpts()) {
-            if (excerpt->excerptScore() != score) {
+        for (Excerpt* excerpt : mScore->excerpts()) {
+            if (excerpt->ensureExcerptLoaded() != score) {
                 write::Writer::write(excerpt->excerptScore(), xml, ctx, *this); // recursion write
             }
         }
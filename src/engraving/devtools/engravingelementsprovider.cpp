@@ -32,6 +32,7 @@
 namespace mu::engraving {
 void EngravingElementsProvider::clearStatistic()
 {
+    std::lock_guard<std::mutex> lock(m_elementsMutex);
     m_statistics.clear();
 }
 
@@ -67,12 +68,14 @@ void EngravingElementsProvider::printStatistic(const std::string& title)
 
 void EngravingElementsProvider::reg(const mu::engraving::EngravingObject* e)
 {
+    std::lock_guard<std::mutex> lock(m_elementsMutex);
     m_elements.insert(e);
     m_statistics[e->typeName()].regCount++;
 }
 
 void EngravingElementsProvider::unreg(const mu::engraving::EngravingObject* e)
 {
+    std::lock_guard<std::mutex> lock(m_elementsMutex);
     m_elements.erase(e);
     m_statistics[e->typeName()].unregCount++;
 }
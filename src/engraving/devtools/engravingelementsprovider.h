@@ -24,6 +24,7 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 
 #include "iengravingelementsprovider.h"
 
@@ -62,6 +63,7 @@ private:
     std::map<std::string, ObjectStatistic> m_statistics;
 
     EngravingObjectSet m_elements;
+    std::mutex m_elementsMutex; // elements can be created on reading and export threads
 
     EngravingObjectSet m_selected;
     muse::async::Channel<const mu::engraving::EngravingObject*, bool> m_selectChanged;
@@ -126,9 +126,7 @@ void BspTree::clear()
 
 void BspTree::insert(EngravingItem* element)
 {
-    InsertItemBspTreeVisitor insertVisitor;
-    insertVisitor.item = element;
-    climbTree(&insertVisitor, element->pageBoundingRect());
+    insert(element, element->pageBoundingRect());
 }
 
 //---------------------------------------------------------
@@ -136,10 +134,44 @@ void BspTree::insert(EngravingItem* element)
 //---------------------------------------------------------
 
 void BspTree::remove(EngravingItem* element)
+{
+    remove(element, element->pageBoundingRect());
+}
+
+void BspTree::insert(EngravingItem* element, const RectF& rect)
+{
+    InsertItemBspTreeVisitor insertVisitor;
+    insertVisitor.item = element;
+    climbTree(&insertVisitor, rect);
+}
+
+void BspTree::remove(EngravingItem* element, const RectF& rect)
 {
     RemoveItemBspTreeVisitor removeVisitor;
     removeVisitor.item = element;
-    climbTree(&removeVisitor, element->pageBoundingRect());
+    climbTree(&removeVisitor, rect);
+}
+
+//---------------------------------------------------------
+//   move
+//---------------------------------------------------------
+
+void BspTree::move(EngravingItem* element, const RectF& oldRect, const RectF& newRect)
+{
+    remove(element, oldRect);
+    insert(element, newRect);
+}
+
+//---------------------------------------------------------
+//   fitsItemCount
+//    Whether the depth of the tree is still reasonable
+//    for n items, otherwise it should be initialized again
+//---------------------------------------------------------
+
+bool BspTree::fitsItemCount(int n) const
+{
+    int depth = intmaxlog(n);
+    return depth + 1 >= int(m_depth) && depth <= int(m_depth) + 1;
 }
 
 //---------------------------------------------------------
@@ -79,6 +79,16 @@ public:
     void insert(EngravingItem* item);
     void remove(EngravingItem* item);
 
+    // rect is the page bounding rect the item was inserted with,
+    // the item itself isn't accessed by remove, so it may be deleted already
+    void insert(EngravingItem* item, const RectF& rect);
+    void remove(EngravingItem* item, const RectF& rect);
+    void move(EngravingItem* item, const RectF& oldRect, const RectF& newRect);
+
+    const RectF& rect() const { return m_rect; }
+    bool isEmpty() const { return m_nodes.empty(); }
+    bool fitsItemCount(int n) const;
+
     std::vector<EngravingItem*> items(const RectF& rect);
     std::vector<EngravingItem*> items(const PointF& pos);
 
@@ -73,7 +73,8 @@ Excerpt::Excerpt(const Excerpt& ex, bool copyContents)
 {
     if (copyContents) {
         m_tracksMapping = ex.m_tracksMapping;
-        m_excerptScore = ex.m_excerptScore ? ex.m_excerptScore->clone() : nullptr;
+        Score* score = ex.excerptScore();
+        m_excerptScore = score ? score->clone() : nullptr;
 
         if (m_excerptScore) {
             m_excerptScore->setExcerpt(this);
@@ -116,6 +117,31 @@ void Excerpt::setInitialPartId(const ID& id)
     m_initialPartId = id;
 }
 
+Score* Excerpt::excerptScore() const
+{
+    return m_excerptScore;
+}
+
+void Excerpt::setDeferredScore(std::unique_ptr<DeferredScore> deferredScore)
+{
+    m_deferredScore = std::move(deferredScore);
+}
+
+Score* Excerpt::ensureExcerptLoaded()
+{
+    if (!m_deferredScore) {
+        return m_excerptScore;
+    }
+
+    TRACEFUNC;
+
+    //! NOTE Reset first, the reader accesses the excerpt score
+    std::unique_ptr<DeferredScore> deferredScore = std::move(m_deferredScore);
+    deferredScore->read(this, *deferredScore);
+
+    return m_excerptScore;
+}
+
 void Excerpt::setExcerptScore(Score* s)
 {
     m_excerptScore = s;
@@ -232,6 +258,10 @@ size_t Excerpt::nstaves() const
 
 bool Excerpt::isEmpty() const
 {
+    if (m_deferredScore) {
+        return m_parts.empty();
+    }
+
     return excerptScore() ? excerptScore()->parts().empty() : true;
 }
 
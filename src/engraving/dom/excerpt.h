@@ -23,8 +23,12 @@
 #ifndef MU_ENGRAVING_EXCERPT_H
 #define MU_ENGRAVING_EXCERPT_H
 
+#include <functional>
+#include <memory>
+
 #include "../types/fraction.h"
 #include "../types/types.h"
+#include "types/bytearray.h"
 #include "types/string.h"
 
 #include "async/notification.h"
@@ -32,6 +36,7 @@
 namespace mu::engraving {
 class MasterScore;
 class Measure;
+class MscLoader;
 class Part;
 class Score;
 class Staff;
@@ -54,9 +59,25 @@ public:
     void setInitialPartId(const ID& id);
 
     MasterScore* masterScore() const { return m_masterScore; }
-    Score* excerptScore() const { return m_excerptScore; }
+    // nullptr while the part score is deferred, see ensureExcerptLoaded()
+    Score* excerptScore() const;
     void setExcerptScore(Score* s);
 
+    // A part score that is read from the file when it is first needed.
+    // Until then only the name, the parts and the file data are known.
+    struct DeferredScore {
+        muse::ByteArray styleData;
+        muse::ByteArray scoreData;
+        std::function<void(Excerpt*, const DeferredScore&)> read;
+    };
+
+    bool isDeferred() const { return m_deferredScore != nullptr; }
+    const DeferredScore* deferredScore() const { return m_deferredScore.get(); }
+    void setDeferredScore(std::unique_ptr<DeferredScore> deferredScore);
+
+    // Reads the part score if it is deferred, then returns it
+    Score* ensureExcerptLoaded();
+
     const String& name() const;
     void setName(const String& name, bool saveAndNotify = true);
     muse::async::Notification nameChanged() const;
@@ -98,6 +119,7 @@ public:
 
 private:
     friend class MasterScore;
+    friend class MscLoader;
 
     static void promoteGapRestsToRealRests(const Measure* measure, staff_idx_t staffIdx);
 
@@ -108,6 +130,7 @@ private:
 
     MasterScore* m_masterScore = nullptr;
     Score* m_excerptScore = nullptr;
+    std::unique_ptr<DeferredScore> m_deferredScore;
     String m_name;
     String m_fileName;
     muse::async::Notification m_nameChanged;
@@ -66,6 +66,7 @@ MasterScore::MasterScore(const muse::modularity::ContextPtr& iocCtx, std::weak_p
 {
     m_project = project;
     m_undoStack   = new UndoStack();
+    m_undoStack->setMemoryBudget(configuration() ? configuration()->undoMemoryBudget() : 0);
     m_tempomap    = new TempoMap;
     m_sigmap      = new TimeSigMap();
     m_automationController = new AutomationController();
@@ -231,6 +232,19 @@ void MasterScore::addExcerpt(Excerpt* ex, size_t index)
     setExcerptsChanged(true);
 }
 
+//---------------------------------------------------------
+//   ensureExcerptsLoaded
+//    Edits are propagated to the linked part scores, so
+//    all of them have to be read before the first edit
+//---------------------------------------------------------
+
+void MasterScore::ensureExcerptsLoaded()
+{
+    for (Excerpt* ex : m_excerpts) {
+        ex->ensureExcerptLoaded();
+    }
+}
+
 //---------------------------------------------------------
 //   removeExcerpt
 //---------------------------------------------------------
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <array>
+#include <mutex>
 
 #include "../infrastructure/ifileinfoprovider.h"
 #include "../infrastructure/eidregister.h"
@@ -134,6 +135,10 @@ public:
     void addLayoutFlags(LayoutFlags val) override { m_cmdState.layoutFlags |= val; }
     void setInstrumentsChanged(bool val) override { m_cmdState.instrumentsChanged = val; }
 
+    //! NOTE Guards the master score state that part scores modify (links
+    //! and MIDI mapping) while they are read concurrently
+    std::recursive_mutex& partsMutex() const { return m_partsMutex; }
+
     void setExcerptsChanged(bool val) { m_cmdState.excerptsChanged = val; }
     bool excerptsChanged() const { return m_cmdState.excerptsChanged; }
     bool instrumentsChanged() const { return m_cmdState.instrumentsChanged; }
@@ -169,6 +174,7 @@ public:
     void initAndAddExcerpt(Excerpt*, bool);
     void initExcerpt(Excerpt*);
     void initEmptyExcerpt(Excerpt*);
+    void ensureExcerptsLoaded();
 
     void initAutomation(); // TODO: Placeholder?
 
@@ -203,6 +209,7 @@ private:
                              InstrChannel* channel, bool useDrumset);
 
     friend class EngravingProject;
+    friend class MscLoader;
     friend class compat::ScoreAccess;
     friend class read114::Read114;
     friend class read400::Read400;
@@ -230,6 +237,7 @@ private:
     bool m_readOnly = false;
 
     CmdState m_cmdState;       // modified during cmd processing
+    mutable std::recursive_mutex m_partsMutex;
 
     std::array<Fraction, 2> m_loopBoundaries; ///< 0 - LoopIn, 1 - LoopOut
 
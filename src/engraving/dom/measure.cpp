@@ -677,18 +677,7 @@ ChordRest* Measure::findChordRest(Fraction t, track_idx_t track) const
 
 Segment* Measure::tick2segment(const Fraction& _t, SegmentType st)
 {
-    Fraction t = _t - tick();
-    for (Segment& s : m_segments) {
-        if (s.rtick() == t) {
-            if (s.segmentType() & st) {
-                return &s;
-            }
-        }
-        if (s.rtick() > t) {
-            break;
-        }
-    }
-    return 0;
+    return m_segments.findAtRtick(_t - tick(), st);
 }
 
 //---------------------------------------------------------
@@ -699,25 +688,7 @@ Segment* Measure::tick2segment(const Fraction& _t, SegmentType st)
 
 Segment* Measure::findSegmentR(SegmentType st, const Fraction& t) const
 {
-    Segment* s;
-    if (t > (ticks() * Fraction(1, 2))) {
-        // search backwards
-        for (s = last(); s && s->rtick() > t; s = s->prev()) {
-        }
-        while (s && s->prev() && s->prev()->rtick() == t) {
-            s = s->prev();
-        }
-    } else {
-        // search forwards
-        for (s = first(); s && s->rtick() < t; s = s->next()) {
-        }
-    }
-    for (; s && s->rtick() == t; s = s->next()) {
-        if (s->segmentType() & st) {
-            return s;
-        }
-    }
-    return 0;
+    return m_segments.findAtRtick(t, st);
 }
 
 //---------------------------------------------------------
@@ -22,6 +22,11 @@
 
 #include "page.h"
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <unordered_set>
+
 #ifndef ENGRAVING_NO_ACCESSIBILITY
 #include "accessibility/accessibleitem.h"
 #endif
@@ -64,6 +69,44 @@ std::vector<EngravingItem*> Page::items(const PointF& point)
     return bspTree.items(point);
 }
 
+//---------------------------------------------------------
+//   displayList
+//---------------------------------------------------------
+
+const std::vector<Page::DisplayItem>& Page::displayList()
+{
+    if (!m_bspTreeValid) {
+        doRebuildBspTree();
+    }
+    return m_displayList;
+}
+
+//---------------------------------------------------------
+//   displayIndex
+//---------------------------------------------------------
+
+size_t Page::displayIndex(const EngravingItem* item)
+{
+    if (!m_bspTreeValid) {
+        doRebuildBspTree();
+    }
+
+    auto it = m_displayIndexes.find(item);
+    return it != m_displayIndexes.end() ? it->second : muse::nidx;
+}
+
+//---------------------------------------------------------
+//   layoutGeneration
+//---------------------------------------------------------
+
+uint64_t Page::layoutGeneration()
+{
+    if (!m_bspTreeValid) {
+        doRebuildBspTree();
+    }
+    return m_layoutGeneration;
+}
+
 //---------------------------------------------------------
 //   appendSystem
 //---------------------------------------------------------
@@ -109,47 +152,183 @@ void Page::scanElements(std::function<void(EngravingItem*)> func)
     }
 }
 
+//---------------------------------------------------------
+//   bspTreeRect
+//---------------------------------------------------------
+
+RectF Page::bspTreeRect() const
+{
+    if (!score()->linearMode()) {
+        return pageBoundingRect();
+    }
+
+    double w = 0.0;
+    double h = 0.0;
+    if (!m_systems.empty()) {
+        h = m_systems.front()->height();
+        if (!m_systems.front()->measures().empty()) {
+            MeasureBase* mb = m_systems.front()->measures().back();
+            w = mb->x() + mb->width();
+        }
+    }
+    return RectF(0.0, 0.0, w, h);
+}
+
 //---------------------------------------------------------
 //   doRebuildBspTree
+//    Layout doesn't tell which items it has changed, so
+//    the page is scanned again, but only the items which
+//    were added, removed or moved since the last update are
+//    updated in the tree. The tree is only built from scratch
+//    if the page size or the number of items changed a lot.
 //---------------------------------------------------------
 
 void Page::doRebuildBspTree()
 {
-    int n = 0;
-    auto countElements = [&](EngravingItem* item) {
+    std::vector<EngravingItem*> items;
+    auto collectElements = [&](EngravingItem* item) {
         if (item->collectForDrawing()) {
-            ++n;
+            items.push_back(item);
         }
     };
 
-    scanElements(countElements);
-
-    RectF r;
-    if (score()->linearMode()) {
-        double w = 0.0;
-        double h = 0.0;
-        if (!m_systems.empty()) {
-            h = m_systems.front()->height();
-            if (!m_systems.front()->measures().empty()) {
-                MeasureBase* mb = m_systems.front()->measures().back();
-                w = mb->x() + mb->width();
-            }
+    scanElements(collectElements);
+
+    RectF r = bspTreeRect();
+    int n = static_cast<int>(items.size());
+
+    if (bspTree.isEmpty() || bspTree.rect() != r || !bspTree.fitsItemCount(n)) {
+        bspTree.initialize(r, n);
+        m_bspItemRects.clear();
+
+        for (EngravingItem* item : items) {
+            RectF itemRect = item->pageBoundingRect();
+            bspTree.insert(item, itemRect);
+            m_bspItemRects.emplace(item, itemRect);
         }
-        r = RectF(0.0, 0.0, w, h);
     } else {
-        r = pageBoundingRect();
+        std::unordered_map<EngravingItem*, RectF> itemRects;
+        itemRects.reserve(items.size());
+
+        for (EngravingItem* item : items) {
+            RectF itemRect = item->pageBoundingRect();
+            if (!itemRects.emplace(item, itemRect).second) {
+                continue;
+            }
+
+            auto it = m_bspItemRects.find(item);
+            if (it == m_bspItemRects.end()) {
+                bspTree.insert(item, itemRect);
+            } else {
+                if (it->second != itemRect) {
+                    bspTree.move(item, it->second, itemRect);
+                }
+                m_bspItemRects.erase(it);
+            }
+        }
+
+        // what's left is not on the page anymore
+        for (const auto& pair : m_bspItemRects) {
+            bspTree.remove(pair.first, pair.second);
+        }
+
+        m_bspItemRects = std::move(itemRects);
     }
 
-    bspTree.initialize(r, n);
+    updateDisplayList(items);
+    updateLayoutGeneration();
 
-    auto bspInsert = [&] (EngravingItem* item) {
-        if (item->collectForDrawing()) {
-            bspTree.insert(item);
+    m_bspTreeValid = true;
+}
+
+//---------------------------------------------------------
+//   updateLayoutGeneration
+//---------------------------------------------------------
+
+void Page::updateLayoutGeneration()
+{
+    static std::atomic<uint64_t> s_lastLayoutGeneration = 0;
+    m_layoutGeneration = ++s_lastLayoutGeneration;
+}
+
+//---------------------------------------------------------
+//   updateBspItem
+//    Updates a single item which changed its bounding rect
+//    without a relayout of the page
+//---------------------------------------------------------
+
+void Page::updateBspItem(EngravingItem* item)
+{
+    if (!m_bspTreeValid) {
+        return;
+    }
+
+    auto it = m_bspItemRects.find(item);
+    if (it == m_bspItemRects.end() || !item->collectForDrawing()) {
+        invalidateBspTree();
+        return;
+    }
+
+    RectF itemRect = item->pageBoundingRect();
+    if (it->second != itemRect) {
+        bspTree.move(item, it->second, itemRect);
+        it->second = itemRect;
+
+        auto displayIt = m_displayIndexes.find(item);
+        if (displayIt != m_displayIndexes.end()) {
+            m_displayList[displayIt->second].rect = itemRect;
         }
+    }
+
+    // the shape of the item may have changed even if its bounding rect didn't
+    updateLayoutGeneration();
+}
+
+//---------------------------------------------------------
+//   updateDisplayList
+//    Items which are still on the page with the same z and
+//    track keep their order, so only the new ones are
+//    sorted and merged in
+//---------------------------------------------------------
+
+void Page::updateDisplayList(const std::vector<EngravingItem*>& items)
+{
+    auto displayItemLessThan = [](const DisplayItem& i1, const DisplayItem& i2) {
+        return i1.z < i2.z || (i1.z == i2.z && i1.track < i2.track);
     };
-    scanElements(bspInsert);
 
-    m_bspTreeValid = true;
+    std::unordered_set<const EngravingItem*> pending(items.begin(), items.end());
+
+    std::vector<DisplayItem> kept;
+    kept.reserve(items.size());
+    for (const DisplayItem& di : m_displayList) {
+        // items which are not on the page anymore may be deleted already
+        auto it = pending.find(di.item);
+        if (it != pending.end() && di.z == di.item->z() && di.track == di.item->track()) {
+            pending.erase(it);
+            kept.push_back(di);
+            kept.back().rect = m_bspItemRects.at(di.item);
+        }
+    }
+
+    std::vector<DisplayItem> added;
+    for (EngravingItem* item : items) {
+        if (pending.erase(item) > 0) {
+            added.push_back({ item, item->z(), item->track(), m_bspItemRects.at(item) });
+        }
+    }
+
+    std::sort(added.begin(), added.end(), displayItemLessThan);
+
+    m_displayList.clear();
+    m_displayList.reserve(kept.size() + added.size());
+    std::merge(kept.begin(), kept.end(), added.begin(), added.end(), std::back_inserter(m_displayList), displayItemLessThan);
+
+    m_displayIndexes.clear();
+    m_displayIndexes.reserve(m_displayList.size());
+    for (size_t i = 0; i < m_displayList.size(); ++i) {
+        m_displayIndexes.emplace(m_displayList[i].item, i);
+    }
 }
 
 //---------------------------------------------------------
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <array>
+#include <unordered_map>
 #include <vector>
 
 #include "bsp.h"
@@ -73,6 +74,25 @@ public:
     std::vector<EngravingItem*> items(const RectF& r);
     std::vector<EngravingItem*> items(const PointF& p);
     void invalidateBspTree() { m_bspTreeValid = false; }
+    void updateBspItem(EngravingItem* item);
+
+    //! NOTE Changes every time the items of the page are updated after a layout
+    //! or by updateBspItem(), unique among all pages, so data derived from the items can be cached by it
+    uint64_t layoutGeneration();
+
+    struct DisplayItem {
+        EngravingItem* item = nullptr;
+        int z = 0;
+        track_idx_t track = 0;
+        RectF rect;                 // page bounding rect, as in the bsp tree
+    };
+
+    //! NOTE Items collected for drawing, ordered by z and track.
+    //! Updated together with the bsp tree, only the items
+    //! added or restacked since the last update are sorted
+    const std::vector<DisplayItem>& displayList();
+    size_t displayIndex(const EngravingItem* item);   // position in displayList(), muse::nidx if not on the page
+
     PointF pagePos() const override { return PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     RectF tbbox() const;                             // tight bounding box, excluding white space
@@ -92,6 +112,9 @@ private:
     Page(RootItem* parent);
 
     void doRebuildBspTree();
+    RectF bspTreeRect() const;
+    void updateDisplayList(const std::vector<EngravingItem*>& items);
+    void updateLayoutGeneration();
 
     std::vector<System*> m_systems;
     page_idx_t m_pageNumber = 0;
@@ -100,6 +123,10 @@ private:
     std::array<Text*, MAX_FOOTERS> m_footerTexts {};
 
     BspTree bspTree;
+    std::unordered_map<EngravingItem*, RectF> m_bspItemRects;
     bool m_bspTreeValid = false;
+    uint64_t m_layoutGeneration = 0;
+    std::vector<DisplayItem> m_displayList;
+    std::unordered_map<const EngravingItem*, size_t> m_displayIndexes;
 };
 }
@@ -4366,6 +4366,12 @@ void Score::undo(UndoCommand* cmd, EditData* ed) const
 //   scoreList
 //    return a list of scores containing the root score
 //    and all part scores (if there are any)
+//    Deferred part scores (Excerpt::isDeferred) are not
+//    listed: they have no items yet, so there is nothing
+//    in them to lay out, update, select or play. Edits
+//    read them first (see Score::startCmd), callers that
+//    need every part score otherwise call
+//    MasterScore::ensureExcerptsLoaded()
 //---------------------------------------------------------
 
 std::list<Score*> Score::scoreList()
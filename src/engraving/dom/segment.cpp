@@ -196,6 +196,22 @@ void Segment::setParent(Measure* parent)
     EngravingItem::setParent(parent);
 }
 
+//---------------------------------------------------------
+//   setRtick
+//---------------------------------------------------------
+
+void Segment::setRtick(const Fraction& v)
+{
+    assert(v >= Fraction(0, 1));
+    if (m_tick == v) {
+        return;
+    }
+    m_tick = v;
+    if (explicitParent() && explicitParent()->isMeasure()) {
+        toMeasure(explicitParent())->segments().invalidateTickIndex();
+    }
+}
+
 //---------------------------------------------------------
 //   setSegmentType
 //---------------------------------------------------------
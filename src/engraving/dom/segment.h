@@ -212,7 +212,7 @@ public:
     void setStretch(double v) { m_stretch = v; }
 
     Fraction rtick() const override { return m_tick; }
-    void setRtick(const Fraction& v) { assert(v >= Fraction(0, 1)); m_tick = v; }
+    void setRtick(const Fraction& v);
     Fraction tick() const override;
 
     Fraction ticks() const { return m_ticks; }
@@ -21,6 +21,9 @@
  */
 
 #include "segmentlist.h"
+
+#include <algorithm>
+
 #include "segment.h"
 #include "score.h"
 
@@ -156,6 +159,18 @@ void SegmentList::insert(Segment* e, Segment* el)
         e->setPrev(el->prev());
         el->prev()->setNext(e);
         el->setPrev(e);
+
+        if (m_tickIndex.valid) {
+            auto it = findInTickIndex(el);
+            bool keepsOrder = it != m_tickIndex.segments.end()
+                              && e->rtick() <= el->rtick()
+                              && (it == m_tickIndex.segments.begin() || (*std::prev(it))->rtick() <= e->rtick());
+            if (keepsOrder) {
+                m_tickIndex.segments.insert(it, e);
+            } else {
+                invalidateTickIndex();
+            }
+        }
     }
     check();
 }
@@ -197,6 +212,15 @@ void SegmentList::remove(Segment* e)
         e->prev()->setNext(e->next());
         e->next()->setPrev(e->prev());
     }
+
+    if (m_tickIndex.valid) {
+        auto it = findInTickIndex(e);
+        if (it != m_tickIndex.segments.end()) {
+            m_tickIndex.segments.erase(it);
+        } else {
+            invalidateTickIndex();
+        }
+    }
 }
 
 //---------------------------------------------------------
@@ -213,6 +237,15 @@ void SegmentList::push_back(Segment* e)
         m_first = e;
     }
     e->setPrev(m_last);
+
+    if (m_tickIndex.valid) {
+        if (m_tickIndex.sorted && (!m_last || m_last->rtick() <= e->rtick())) {
+            m_tickIndex.segments.push_back(e);
+        } else {
+            invalidateTickIndex();
+        }
+    }
+
     m_last = e;
     check();
 }
@@ -231,10 +264,107 @@ void SegmentList::push_front(Segment* e)
         m_last = e;
     }
     e->setNext(m_first);
+
+    if (m_tickIndex.valid) {
+        if (m_tickIndex.sorted && (!m_first || e->rtick() <= m_first->rtick())) {
+            m_tickIndex.segments.insert(m_tickIndex.segments.begin(), e);
+        } else {
+            invalidateTickIndex();
+        }
+    }
+
     m_first = e;
     check();
 }
 
+//---------------------------------------------------------
+//   ensureTickIndex
+//    returns false if the index can't be used for binary
+//    search because the segments are not ordered by rtick
+//---------------------------------------------------------
+
+bool SegmentList::ensureTickIndex() const
+{
+    if (m_tickIndex.valid) {
+        return m_tickIndex.sorted;
+    }
+
+    std::vector<Segment*>& segments = m_tickIndex.segments;
+    segments.clear();
+    segments.reserve(m_size);
+
+    bool sorted = true;
+    for (Segment* s = m_first; s; s = s->next()) {
+        if (sorted && !segments.empty() && s->rtick() < segments.back()->rtick()) {
+            sorted = false;
+        }
+        segments.push_back(s);
+    }
+
+    m_tickIndex.valid = true;
+    m_tickIndex.sorted = sorted;
+    return sorted;
+}
+
+//---------------------------------------------------------
+//   findInTickIndex
+//---------------------------------------------------------
+
+std::vector<Segment*>::iterator SegmentList::findInTickIndex(const Segment* s) const
+{
+    std::vector<Segment*>& segments = m_tickIndex.segments;
+    if (!m_tickIndex.sorted) {
+        return segments.end();
+    }
+
+    auto it = std::lower_bound(segments.begin(), segments.end(), s->rtick(), [](const Segment* seg, const Fraction& tick) {
+        return seg->rtick() < tick;
+    });
+    for (; it != segments.end() && (*it)->rtick() == s->rtick(); ++it) {
+        if (*it == s) {
+            return it;
+        }
+    }
+    return segments.end();
+}
+
+//---------------------------------------------------------
+//   findAtRtick
+//    Return the first (or last) segment of one of the given
+//    types at measure relative tick rtick.
+//---------------------------------------------------------
+
+Segment* SegmentList::findAtRtick(const Fraction& rtick, SegmentType types, bool first) const
+{
+    Segment* found = nullptr;
+
+    if (!ensureTickIndex()) {
+        for (Segment* s = m_first; s; s = s->next()) {
+            if (s->rtick() == rtick && (s->segmentType() & types)) {
+                if (first) {
+                    return s;
+                }
+                found = s;
+            }
+        }
+        return found;
+    }
+
+    const std::vector<Segment*>& segments = m_tickIndex.segments;
+    auto it = std::lower_bound(segments.begin(), segments.end(), rtick, [](const Segment* seg, const Fraction& tick) {
+        return seg->rtick() < tick;
+    });
+    for (; it != segments.end() && (*it)->rtick() == rtick; ++it) {
+        if ((*it)->segmentType() & types) {
+            if (first) {
+                return *it;
+            }
+            found = *it;
+        }
+    }
+    return found;
+}
+
 //---------------------------------------------------------
 //   firstCRSegment
 //---------------------------------------------------------
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "segment.h"
 
 namespace mu::engraving {
@@ -35,7 +37,7 @@ class SegmentList
 {
 public:
     SegmentList() { clear(); }
-    void clear() { m_first = m_last = 0; m_size = 0; }
+    void clear() { m_first = m_last = 0; m_size = 0; invalidateTickIndex(); }
 #ifndef NDEBUG
     void check();
 #else
@@ -60,6 +62,10 @@ public:
     void push_front(Segment*);
     void insert(Segment* e, Segment* el);    // insert e before el
 
+    Segment* findAtRtick(const Fraction& rtick, SegmentType types, bool first = true) const;
+    void invalidateTickIndex() const { m_tickIndex.valid = false; }   // must be called if a segment changes its rtick
+    void updateTickIndex() const { ensureTickIndex(); }                // builds the index findAtRtick() would build lazily
+
     class iterator
     {
         Segment* p;
@@ -86,9 +92,33 @@ public:
 
 private:
 
+    //---------------------------------------------------------
+    //   TickIndex
+    //    The segments in list order, built on demand for
+    //    lookups by tick. Copies start out invalid, as they
+    //    would refer to the segments of another list.
+    //---------------------------------------------------------
+
+    struct TickIndex {
+        std::vector<Segment*> segments;
+        bool valid = false;
+        bool sorted = false;             // segments are ordered by rtick, so binary search can be used
+
+        TickIndex() = default;
+        TickIndex(const TickIndex&) {}
+        TickIndex& operator=(const TickIndex&) { segments.clear(); valid = false; return *this; }
+    };
+
+    bool ensureTickIndex() const;
+    std::vector<Segment*>::iterator findInTickIndex(const Segment* s) const;
+
     Segment* m_first = nullptr;          // First item of segment list
     Segment* m_last = nullptr;           // Last item of segment list
     int m_size = 0;                      // Number of items in segment list
+
+    //! NOTE Built lazily by findAtRtick(), so even that const lookup may write it.
+    //! It is not thread safe: call updateTickIndex() first if several threads look up the same list.
+    mutable TickIndex m_tickIndex;
 };
 
 // Segment* begin(SegmentList& l) { return l.first(); }
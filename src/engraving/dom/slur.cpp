@@ -526,7 +526,7 @@ void Slur::undoChangeStartEndElements(ChordRest* scr, ChordRest* ecr)
 
 void Slur::setTrack(track_idx_t n)
 {
-    EngravingItem::setTrack(n);
+    Spanner::setTrack(n);
     for (SpannerSegment* ss : spannerSegments()) {
         ss->setTrack(n);
     }
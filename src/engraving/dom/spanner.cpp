@@ -1367,7 +1367,7 @@ void Spanner::setTick(const Fraction& v)
     Score* score = this->score();
 
     if (score) {
-        score->spannerMap().setDirty();
+        score->spannerMap().updateSpanner(this);
     }
 }
 
@@ -1399,7 +1399,7 @@ void Spanner::setTicks(const Fraction& f)
     Score* score = this->score();
 
     if (score) {
-        score->spannerMap().setDirty();
+        score->spannerMap().updateSpanner(this);
     }
 }
 
@@ -1414,6 +1414,23 @@ bool Spanner::isVoiceSpecific() const
     return VOICE_SPECIFIC_SPANNERS.find(type()) != VOICE_SPECIFIC_SPANNERS.end();
 }
 
+//---------------------------------------------------------
+//   setTrack
+//---------------------------------------------------------
+
+void Spanner::setTrack(track_idx_t val)
+{
+    const bool changed = track() != val;
+
+    EngravingItem::setTrack(val);
+
+    Score* score = this->score();
+
+    if (changed && score) {
+        score->spannerMap().updateSpanner(this);   // may have moved to another part
+    }
+}
+
 track_idx_t Spanner::track2() const
 {
     return canBeCrossStaff() ? m_track2 : m_track;
@@ -1425,7 +1442,17 @@ void Spanner::setTrack2(track_idx_t v)
         return;
     }
 
+    if (m_track2 == v) {
+        return;
+    }
+
     m_track2 = v;
+
+    Score* score = this->score();
+
+    if (score) {
+        score->spannerMap().updateSpanner(this);
+    }
 }
 
 track_idx_t Spanner::effectiveTrack2() const
@@ -170,6 +170,7 @@ public:
     void setTicks(const Fraction&);
 
     bool isVoiceSpecific() const;
+    void setTrack(track_idx_t val) override;
     track_idx_t track2() const;
     void setTrack2(track_idx_t v);
     track_idx_t effectiveTrack2() const;
@@ -21,6 +21,9 @@
  */
 
 #include "spannermap.h"
+
+#include <algorithm>
+
 #include "spanner.h"
 #include "part.h"
 
@@ -41,31 +44,184 @@ SpannerMap::SpannerMap()
 
 //---------------------------------------------------------
 //   update
-//   updates the internal lookup tree, not the map itself
+//   rebuilds the internal lookup trees, not the map itself
 //---------------------------------------------------------
 
 void SpannerMap::update() const
 {
-    IntervalList regularIntervals;
-    IntervalList collisionFreeIntervals;
+    m_tree.clear();
+    m_collisionFreeTree.clear();
+    m_groups.clear();
+    m_entries.clear();
+    m_pending.clear();
+    m_nextId = 0;
+    m_hasDuplicates = false;
 
-    collectIntervals(regularIntervals, collisionFreeIntervals);
+    for (const auto& pair : *this) {
+        auto [it, inserted] = m_entries.try_emplace(pair.second);
+        if (inserted) {
+            it->second.id = m_nextId++;
+            indexSpanner(pair.second, it->second);
+        } else {
+            // the same spanner added twice: index it again, but any change
+            // to the map will require a full rebuild to get rid of it
+            Entry duplicate;
+            duplicate.id = m_nextId++;
+            indexSpanner(pair.second, duplicate);
+            m_hasDuplicates = true;
+        }
+    }
 
-    m_tree = interval_tree::IntervalTree<Spanner*>(std::move(regularIntervals));
-    m_collisionFreeTree = interval_tree::IntervalTree<Spanner*>(std::move(collisionFreeIntervals));
     m_dirty = false;
 }
 
 //---------------------------------------------------------
-//   findContained
+//   updateSpanner
+//   re-keys a single spanner in the lookup trees
 //---------------------------------------------------------
 
-const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
+void SpannerMap::updateSpanner(const Spanner* s) const
+{
+    if (m_hasDuplicates) {
+        m_dirty = true;
+        return;
+    }
+
+    auto it = m_entries.find(s);
+    if (it == m_entries.end() || !it->second.indexed) {
+        return;
+    }
+
+    unindexSpanner(it->second);
+    m_pending.push_back(const_cast<Spanner*>(s));
+}
+
+//---------------------------------------------------------
+//   flush
+//   indexes the spanners added or changed since the last query
+//---------------------------------------------------------
+
+void SpannerMap::flush() const
 {
     if (m_dirty) {
         update();
+        return;
+    }
+
+    if (m_pending.empty()) {
+        return;
+    }
+
+    for (Spanner* s : m_pending) {
+        auto it = m_entries.find(s);
+        if (it != m_entries.end() && !it->second.indexed) {
+            indexSpanner(s, it->second);
+        }
+    }
+    m_pending.clear();
+}
+
+//---------------------------------------------------------
+//   indexSpanner
+//---------------------------------------------------------
+
+void SpannerMap::indexSpanner(Spanner* s, Entry& e) const
+{
+    interval_tree::Interval<Spanner*> interval(s->tick().ticks(), s->tick2().ticks(), s);
+    m_tree.insert(interval, e.id);
+    e.start = interval.start;
+    e.indexed = true;
+
+    const Part* part = s->part();
+    if (!part) {
+        e.grouped = false;
+        return;
+    }
+
+    e.group = { part->id(), s->type() };
+    e.grouped = true;
+
+    Group& group = m_groups[e.group];
+    auto it = group.insert({ interval.start, e.id, interval.stop, s }).first;
+    insertCollisionFree(group, it);
+
+    // the previous spanner of the group may now collide with this one
+    if (it != group.begin()) {
+        auto prev = std::prev(it);
+        m_collisionFreeTree.remove(prev->start, prev->id);
+        insertCollisionFree(group, prev);
+    }
+}
+
+//---------------------------------------------------------
+//   unindexSpanner
+//---------------------------------------------------------
+
+void SpannerMap::unindexSpanner(Entry& e) const
+{
+    m_tree.remove(e.start, e.id);
+    e.indexed = false;
+
+    if (!e.grouped) {
+        return;
+    }
+
+    e.grouped = false;
+    m_collisionFreeTree.remove(e.start, e.id);
+
+    auto groupIt = m_groups.find(e.group);
+    IF_ASSERT_FAILED(groupIt != m_groups.end()) {
+        return;
+    }
+
+    Group& group = groupIt->second;
+    auto it = group.find({ e.start, e.id, 0, nullptr });
+    IF_ASSERT_FAILED(it != group.end()) {
+        return;
+    }
+
+    auto next = group.erase(it);
+    if (next != group.begin()) {
+        auto prev = std::prev(next);
+        m_collisionFreeTree.remove(prev->start, prev->id);
+        insertCollisionFree(group, prev);
     }
 
+    if (group.empty()) {
+        m_groups.erase(groupIt);
+    }
+}
+
+//---------------------------------------------------------
+//   insertCollisionFree
+//   see collectIntervals: a spanner overlapping the next one of
+//   the same part and type is cut right before the next one starts
+//---------------------------------------------------------
+
+void SpannerMap::insertCollisionFree(const Group& group, Group::const_iterator it) const
+{
+    constexpr int collidingSpannersPadding = 1;
+
+    interval_tree::Interval<Spanner*> interval(it->start, it->stop, it->spanner);
+
+    auto next = std::next(it);
+    if (next != group.end() && interval.stop >= next->start) {
+        if (!it->spanner->isLinked(next->spanner)) {
+            interval.stop = next->start - collidingSpannersPadding;
+        }
+    }
+
+    m_collisionFreeTree.insert(interval, it->id);
+}
+
+//---------------------------------------------------------
+//   findContained
+//---------------------------------------------------------
+
+const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
+{
+    flush();
+
     m_results.clear();
 
     if (excludeCollisions) {
@@ -83,9 +239,7 @@ const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, b
 
 const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop, bool excludeCollisions) const
 {
-    if (m_dirty) {
-        update();
-    }
+    flush();
 
     m_results.clear();
 
@@ -153,7 +307,15 @@ void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList&
 void SpannerMap::addSpanner(Spanner* s)
 {
     insert(std::pair<int, Spanner*>(s->tick().ticks(), s));
-    m_dirty = true;
+
+    auto [it, inserted] = m_entries.try_emplace(s);
+    if (!inserted || m_hasDuplicates) {
+        m_dirty = true;
+        return;
+    }
+
+    it->second.id = m_nextId++;
+    m_pending.push_back(s);
 }
 
 //---------------------------------------------------------
@@ -162,15 +324,52 @@ void SpannerMap::addSpanner(Spanner* s)
 
 bool SpannerMap::removeSpanner(Spanner* s)
 {
-    for (auto i = begin(); i != end(); ++i) {
-        if (i->second == s) {
-            erase(i);
-            m_dirty = true;
-            return true;
+    auto i = end();
+
+    auto range = equal_range(s->tick().ticks());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == s) {
+            i = it;
+            break;
+        }
+    }
+
+    // the key may be outdated if the tick was changed after adding
+    if (i == end()) {
+        i = std::find_if(begin(), end(), [s](const auto& pair) { return pair.second == s; });
+    }
+
+    if (i == end()) {
+        LOGD("%s (%p) not found", s->typeName(), s);
+        return false;
+    }
+
+    erase(i);
+
+    if (m_hasDuplicates) {
+        m_dirty = true;
+        return true;
+    }
+
+    auto entryIt = m_entries.find(s);
+    if (entryIt != m_entries.end()) {
+        if (entryIt->second.indexed) {
+            unindexSpanner(entryIt->second);
         }
+        m_entries.erase(entryIt);
     }
-    LOGD("%s (%p) not found", s->typeName(), s);
-    return false;
+
+    return true;
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void SpannerMap::clear()
+{
+    std::multimap<int, Spanner*>::clear();
+    update();
 }
 
 #ifndef NDEBUG
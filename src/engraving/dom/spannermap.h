@@ -24,8 +24,11 @@
 #define MU_ENGRAVING_SPANNERMAP_H
 
 #include <map>
+#include <set>
+#include <unordered_map>
 
-#include "engraving/thirdparty/intervaltree/IntervalTree.h"
+#include "engraving/infrastructure/intervalindex.h"
+#include "engraving/types/types.h"
 
 namespace mu::engraving {
 class Spanner;
@@ -46,6 +49,17 @@ public:
 
     const IntervalList& findContained(int start, int stop, bool excludeCollisions = false) const;
     const IntervalList& findOverlapping(int start, int stop, bool excludeCollisions = false) const;
+
+    // Calls f on all spanners overlapping [start, stop], in the order of findOverlapping().
+    // It doesn't use the shared result list, so once the map is flushed it only reads
+    // and may be called from several threads at once.
+    template<class UnaryFunction>
+    void visitOverlapping(int start, int stop, UnaryFunction f) const
+    {
+        flush();
+        m_tree.visitOverlapping(start, stop, f);
+    }
+
     const std::multimap<int, Spanner*>& map() const { return *this; }
 
     void collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const;
@@ -56,19 +70,56 @@ public:
     const_it cend() const { return std::multimap<int, Spanner*>::cend(); }
     void addSpanner(Spanner* s);
     bool removeSpanner(Spanner* s);
-    void clear() { std::multimap<int, Spanner*>::clear(); m_dirty = true; }
+    void clear();
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
-    void setDirty() const { m_dirty = true; }     // must be called if a spanner changes start/length
+    void updateSpanner(const Spanner* s) const;   // must be called if a spanner changes start/length/track
+    void setDirty() const { m_dirty = true; }     // forces a full rebuild of the lookup trees
+    void flush() const;                           // indexes the spanners added or changed since the last query
 #ifndef NDEBUG
     void dump() const;
 #endif
 
 private:
 
+    using Index = IntervalIndex<Spanner*>;
+    using GroupKey = std::pair<ID, ElementType>;
+
+    // spanners of the same part and type, ordered as in the map
+    struct GroupItem {
+        int start = 0;
+        Index::Id id = 0;
+        int stop = 0;
+        Spanner* spanner = nullptr;
+
+        bool operator<(const GroupItem& other) const
+        {
+            return start < other.start || (start == other.start && id < other.id);
+        }
+    };
+
+    using Group = std::set<GroupItem>;
+
+    struct Entry {
+        Index::Id id = 0;
+        bool indexed = false;
+        int start = 0;
+        bool grouped = false;
+        GroupKey group;
+    };
+
+    void indexSpanner(Spanner* s, Entry& e) const;
+    void unindexSpanner(Entry& e) const;
+    void insertCollisionFree(const Group& group, Group::const_iterator it) const;
+
     mutable bool m_dirty = false;
-    mutable interval_tree::IntervalTree<Spanner*> m_tree;
-    mutable interval_tree::IntervalTree<Spanner*> m_collisionFreeTree;
+    mutable bool m_hasDuplicates = false;
+    mutable Index m_tree;
+    mutable Index m_collisionFreeTree;
+    mutable std::map<GroupKey, Group> m_groups;
+    mutable std::unordered_map<const Spanner*, Entry> m_entries;
+    mutable std::vector<Spanner*> m_pending;
+    mutable Index::Id m_nextId = 0;
     mutable std::vector<interval_tree::Interval<Spanner*> > m_results;
 };
 } // namespace mu::engraving
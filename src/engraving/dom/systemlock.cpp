@@ -149,7 +149,7 @@ void SystemLockIndicator::setSelected(bool v)
 {
     EngravingItem::setSelected(v);
     renderer()->layoutItem(this);
-    system()->page()->invalidateBspTree();
+    system()->page()->updateBspItem(this);
 }
 
 String SystemLockIndicator::formatBarsAndBeats() const
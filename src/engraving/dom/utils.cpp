@@ -173,21 +173,7 @@ Segment* Score::tick2segment(const Fraction& t, bool first, SegmentType st, bool
         LOGD() << "no measure for tick " << tick.ticks();
         return 0;
     }
-    for (Segment* segment   = m->first(st); segment;) {
-        Fraction t1       = segment->tick();
-        Segment* nsegment = segment->next(st);
-        if (tick == t1) {
-            if (first) {
-                return segment;
-            } else {
-                if (!nsegment || tick < nsegment->tick()) {
-                    return segment;
-                }
-            }
-        }
-        segment = nsegment;
-    }
-    return 0;
+    return m->segments().findAtRtick(tick - m->tick(), st, first);
 }
 
 Segment* Score::tick2segment(const Fraction& tick) const
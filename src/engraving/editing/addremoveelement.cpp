@@ -95,6 +95,16 @@ void AddElement::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   AddElement::memoryFootprint
+//---------------------------------------------------------
+
+size_t AddElement::memoryFootprint() const
+{
+    // the element belongs to the score as long as the command isn't undone
+    return UndoCommand::memoryFootprint() + sizeof(AddElement) - sizeof(UndoCommand);
+}
+
 //---------------------------------------------------------
 //   endUndoRedo
 //---------------------------------------------------------
@@ -278,6 +288,16 @@ void RemoveElement::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   RemoveElement::memoryFootprint
+//---------------------------------------------------------
+
+size_t RemoveElement::memoryFootprint() const
+{
+    // the removed element is kept alive by the command
+    return UndoCommand::memoryFootprint() + sizeof(RemoveElement) - sizeof(UndoCommand) + objectFootprint(element);
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
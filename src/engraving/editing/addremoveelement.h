@@ -41,6 +41,7 @@ public:
     EngravingItem* getElement() const { return element; }
     void cleanup(bool) override;
     const char* name() const override;
+    size_t memoryFootprint() const override;
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 
@@ -61,6 +62,7 @@ public:
     void redo(EditData*) override;
     void cleanup(bool) override;
     const char* name() const override;
+    size_t memoryFootprint() const override;
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 
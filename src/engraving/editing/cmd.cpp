@@ -358,6 +358,8 @@ void Score::startCmd(const TranslatableString& actionName)
 
     MScore::setError(MsError::MS_NO_ERROR);
 
+    masterScore()->ensureExcerptsLoaded();
+
     cmdState().reset();
 
     // Start collecting low-level undo operations for a
@@ -63,6 +63,13 @@ std::vector<EngravingObject*> AddExcerpt::objectItems() const
     return {};
 }
 
+size_t AddExcerpt::memoryFootprint() const
+{
+    // the excerpt is kept alive by the command while it is undone
+    return UndoCommand::memoryFootprint() + sizeof(AddExcerpt) - sizeof(UndoCommand)
+           + sizeof(Excerpt) + (excerpt ? scoreFootprint(excerpt->excerptScore()) : 0);
+}
+
 //---------------------------------------------------------
 //   RemoveExcerpt
 //---------------------------------------------------------
@@ -104,6 +111,13 @@ std::vector<EngravingObject*> RemoveExcerpt::objectItems() const
     return {};
 }
 
+size_t RemoveExcerpt::memoryFootprint() const
+{
+    // the excerpt is kept alive by the command while it is removed
+    return UndoCommand::memoryFootprint() + sizeof(RemoveExcerpt) - sizeof(UndoCommand)
+           + sizeof(Excerpt) + (excerpt ? scoreFootprint(excerpt->excerptScore()) : 0);
+}
+
 //---------------------------------------------------------
 //   SwapExcerpt
 //---------------------------------------------------------
@@ -128,6 +142,11 @@ void ChangeExcerptTitle::flip(EditData*)
     excerpt->masterScore()->setExcerptsChanged(true);
 }
 
+size_t ChangeExcerptTitle::memoryFootprint() const
+{
+    return UndoCommand::memoryFootprint() + sizeof(ChangeExcerptTitle) - sizeof(UndoCommand) + title.size() * sizeof(char16_t);
+}
+
 //---------------------------------------------------------
 //   AddPartToExcerpt
 //---------------------------------------------------------
@@ -169,3 +188,9 @@ void AddPartToExcerpt::cleanup(bool undo)
         m_part = nullptr;
     }
 }
+
+size_t AddPartToExcerpt::memoryFootprint() const
+{
+    // the part is kept alive by the command while it is undone
+    return UndoCommand::memoryFootprint() + sizeof(AddPartToExcerpt) - sizeof(UndoCommand) + objectFootprint(m_part);
+}
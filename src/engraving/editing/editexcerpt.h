@@ -44,6 +44,7 @@ public:
     void redo(EditData*) override;
 
     std::vector<EngravingObject*> objectItems() const override;
+    size_t memoryFootprint() const override;
 
     UNDO_TYPE(CommandType::AddExcerpt)
     UNDO_NAME("AddExcerpt")
@@ -65,6 +66,7 @@ public:
     void redo(EditData*) override;
 
     std::vector<EngravingObject*> objectItems() const override;
+    size_t memoryFootprint() const override;
 
     UNDO_TYPE(CommandType::RemoveExcerpt)
     UNDO_NAME("RemoveExcerpt")
@@ -102,6 +104,8 @@ public:
     ChangeExcerptTitle(Excerpt* x, const String& t)
         : excerpt(x), title(t) {}
 
+    size_t memoryFootprint() const override;
+
     UNDO_TYPE(CommandType::ChangeExcerptTitle)
     UNDO_NAME("ChangeExcerptTitle")
 };
@@ -119,6 +123,7 @@ public:
     void undo(EditData*) override;
     void redo(EditData*) override;
     void cleanup(bool undo) override;
+    size_t memoryFootprint() const override;
 
     UNDO_TYPE(CommandType::AddPartToExcerpt)
     UNDO_NAME("AddPartToExcerpt")
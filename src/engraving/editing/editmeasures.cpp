@@ -71,6 +71,23 @@ std::vector<Clef*> InsertRemoveMeasures::getCourtesyClefs(Measure* m)
     return startClefs;
 }
 
+//---------------------------------------------------------
+//   memoryFootprint
+//---------------------------------------------------------
+
+size_t InsertRemoveMeasures::memoryFootprint() const
+{
+    // the measures are kept alive by the command while they are removed
+    size_t size = UndoCommand::memoryFootprint() + sizeof(InsertRemoveMeasures) - sizeof(UndoCommand);
+    for (const MeasureBase* mb = fm; mb; mb = mb->next()) {
+        size += objectFootprint(mb);
+        if (mb == lm) {
+            break;
+        }
+    }
+    return size;
+}
+
 //---------------------------------------------------------
 //   insertMeasures
 //---------------------------------------------------------
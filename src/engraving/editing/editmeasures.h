@@ -46,6 +46,7 @@ public:
         : fm(_fm), lm(_lm), moveStc(_moveStc) {}
     virtual void undo(EditData*) override = 0;
     virtual void redo(EditData*) override = 0;
+    size_t memoryFootprint() const override;
     UNDO_CHANGED_OBJECTS({ fm, lm })
 };
 
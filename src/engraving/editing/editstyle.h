@@ -43,6 +43,8 @@ public:
 
     StyleIdSet changedIds() const;
 
+    size_t memoryFootprint() const override { return UndoCommand::memoryFootprint() + sizeof(ChangeStyle) - sizeof(UndoCommand); }
+
     UNDO_TYPE(CommandType::ChangeStyle)
     UNDO_NAME("ChangeStyle")
     UNDO_CHANGED_OBJECTS({ score })
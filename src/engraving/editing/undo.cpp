@@ -43,6 +43,8 @@
 #include "../dom/fret.h"
 #include "../dom/harmony.h"
 #include "../dom/note.h"
+#include "../dom/score.h"
+#include "../dom/spanner.h"
 #include "../dom/stafftextbase.h"
 
 #include "log.h"
@@ -147,6 +149,60 @@ void UndoCommand::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   UndoCommand::memoryFootprint
+//---------------------------------------------------------
+
+size_t UndoCommand::memoryFootprint() const
+{
+    size_t size = sizeof(UndoCommand) + m_childCommands.capacity() * sizeof(UndoCommand*);
+    for (const UndoCommand* c : m_childCommands) {
+        size += c->memoryFootprint();
+    }
+    return size;
+}
+
+//---------------------------------------------------------
+//   objectFootprint
+//    Rough size of an object tree kept alive by a command,
+//    e.g. a removed element which is needed for undo
+//---------------------------------------------------------
+
+size_t UndoCommand::objectFootprint(const EngravingObject* object)
+{
+    if (!object) {
+        return 0;
+    }
+
+    size_t size = sizeof(EngravingItem);
+    for (const EngravingObject* child : object->children()) {
+        size += objectFootprint(child);
+    }
+    return size;
+}
+
+//---------------------------------------------------------
+//   scoreFootprint
+//    Rough size of a score kept alive by a command,
+//    e.g. the score of a removed excerpt
+//---------------------------------------------------------
+
+size_t UndoCommand::scoreFootprint(const Score* score)
+{
+    if (!score) {
+        return 0;
+    }
+
+    size_t size = sizeof(Score);
+    for (const MeasureBase* mb = score->first(); mb; mb = mb->next()) {
+        size += objectFootprint(mb);
+    }
+    for (const auto& pair : score->spanner()) {
+        size += objectFootprint(pair.second);
+    }
+    return size;
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
@@ -273,7 +329,10 @@ UndoStack::~UndoStack()
 {
     size_t idx = 0;
     for (auto c : m_macroList) {
-        c->cleanup(idx++ < m_currentIndex);
+        if (c) {
+            c->cleanup(idx < m_currentIndex);
+        }
+        ++idx;
     }
     muse::DeleteAll(m_macroList);
 }
@@ -358,19 +417,71 @@ void UndoStack::remove(size_t idx)
     assert(m_currentIndex != muse::nidx);
     // remove redo stack
     while (m_macroList.size() > m_currentIndex) {
-        UndoCommand* cmd = muse::takeLast(m_macroList);
-        m_stateList.pop_back();
-        cmd->cleanup(false);      // delete elements for which UndoCommand() holds ownership
-        delete cmd;
-//            --curIdx;
+        takeLastMacro(false);      // delete elements for which UndoCommand() holds ownership
     }
     while (m_macroList.size() > idx) {
-        UndoCommand* cmd = muse::takeLast(m_macroList);
-        m_stateList.pop_back();
-        cmd->cleanup(true);
-        delete cmd;
+        takeLastMacro(true);
     }
     m_currentIndex = idx;
+    m_droppedCount = std::min(m_droppedCount, idx);
+}
+
+//---------------------------------------------------------
+//   takeLastMacro
+//---------------------------------------------------------
+
+void UndoStack::takeLastMacro(bool undo)
+{
+    UndoCommand* cmd = muse::takeLast(m_macroList);
+    m_stateList.pop_back();
+    m_footprint -= muse::takeLast(m_footprintList);
+    if (cmd) {
+        cmd->cleanup(undo);
+        delete cmd;
+    }
+}
+
+//---------------------------------------------------------
+//   setMemoryBudget
+//---------------------------------------------------------
+
+void UndoStack::setMemoryBudget(size_t bytes)
+{
+    m_memoryBudget = bytes;
+    applyMemoryBudget();
+}
+
+//---------------------------------------------------------
+//   applyMemoryBudget
+//    Drop the oldest macros until the history fits into
+//    the budget. The last two macros are always kept, as
+//    text editing may still merge or reopen them.
+//    The dropped slots stay in the list as nullptr, so the
+//    indices used by the callers remain valid
+//---------------------------------------------------------
+
+void UndoStack::applyMemoryBudget()
+{
+    static constexpr size_t KEPT_MACROS = 2;
+
+    if (m_memoryBudget == 0 || m_activeCommand) {
+        return;
+    }
+
+    while (m_footprint > m_memoryBudget && m_droppedCount + KEPT_MACROS < m_currentIndex) {
+        UndoMacro*& macro = m_macroList[m_droppedCount];
+        macro->cleanup(true);
+        delete macro;
+        macro = nullptr;
+
+        m_footprint -= m_footprintList[m_droppedCount];
+        m_footprintList[m_droppedCount] = 0;
+        ++m_droppedCount;
+    }
+
+    if (m_droppedCount > 0) {
+        LOGD() << "dropped macros: " << m_droppedCount << ", footprint: " << m_footprint << ", budget: " << m_memoryBudget;
+    }
 }
 
 //---------------------------------------------------------
@@ -379,7 +490,15 @@ void UndoStack::remove(size_t idx)
 
 void UndoStack::mergeCommands(size_t startIdx)
 {
-    assert(startIdx <= m_currentIndex);
+    IF_ASSERT_FAILED(startIdx <= m_currentIndex) {
+        return;
+    }
+
+    // dropped macros can't be merged, and merging only the kept part of the range would undo it partially
+    if (startIdx < m_droppedCount) {
+        LOGW() << "can't merge dropped macros, start index: " << startIdx << ", dropped: " << m_droppedCount;
+        return;
+    }
 
     if (startIdx >= m_macroList.size()) {
         return;
@@ -391,6 +510,10 @@ void UndoStack::mergeCommands(size_t startIdx)
         startMacro->append(std::move(*m_macroList[idx]));
     }
     remove(startIdx + 1);   // TODO: remove from startIdx to curIdx only
+
+    m_footprint -= m_footprintList[startIdx];
+    m_footprintList[startIdx] = startMacro->memoryFootprint();
+    m_footprint += m_footprintList[startIdx];
 }
 
 //---------------------------------------------------------
@@ -428,16 +551,17 @@ void UndoStack::endMacro(bool rollback)
     } else {
         // remove redo stack
         while (m_macroList.size() > m_currentIndex) {
-            UndoCommand* cmd = muse::takeLast(m_macroList);
-            m_stateList.pop_back();
-            cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
-            delete cmd;
+            takeLastMacro(false);        // delete elements for which UndoCommand() holds ownership
         }
         m_macroList.push_back(m_activeCommand);
+        m_footprintList.push_back(m_activeCommand->memoryFootprint());
+        m_footprint += m_footprintList.back();
         m_stateList.push_back(m_nextState++);
         ++m_currentIndex;
     }
     m_activeCommand = nullptr;
+
+    applyMemoryBudget();
 }
 
 //---------------------------------------------------------
@@ -452,9 +576,10 @@ void UndoStack::reopen()
 
     LOG_UNDO() << "curIdx: " << m_currentIndex << ", size: " << m_macroList.size();
     assert(m_activeCommand == nullptr);
-    assert(m_currentIndex > 0);
+    assert(m_currentIndex > m_droppedCount);
     --m_currentIndex;
     m_activeCommand = muse::takeAt(m_macroList, m_currentIndex);
+    m_footprint -= muse::takeAt(m_footprintList, m_currentIndex);
     m_stateList.erase(m_stateList.begin() + m_currentIndex);
     for (auto i : m_activeCommand->commands()) {
         LOG_UNDO() << "   " << i->name();
@@ -476,7 +601,7 @@ void UndoStack::undo(EditData* ed)
             return;
         }
     }
-    if (m_currentIndex) {
+    if (canUndo()) {
         --m_currentIndex;
         assert(m_currentIndex < m_macroList.size());
         m_macroList[m_currentIndex]->undo(ed);
@@ -596,6 +721,13 @@ void UndoMacro::append(UndoMacro&& other)
     }
 }
 
+size_t UndoMacro::memoryFootprint() const
+{
+    size_t size = UndoCommand::memoryFootprint() + sizeof(UndoMacro) - sizeof(UndoCommand);
+    size += (m_undoSelectionInfo.elements.capacity() + m_redoSelectionInfo.elements.capacity()) * sizeof(EngravingItem*);
+    return size;
+}
+
 const InputState& UndoMacro::undoInputState() const
 {
     return m_undoInputState;
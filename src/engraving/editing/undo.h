@@ -190,6 +190,10 @@ public:
     virtual CommandType type() const { return CommandType::Unknown; }
 
     virtual bool isFiltered(Filter, const EngravingItem* /* target */) const { return false; }
+
+    // Approximate number of bytes kept alive by this command and its children
+    virtual size_t memoryFootprint() const;
+
     bool hasFilteredChildren(Filter, const EngravingItem* target) const;
     bool hasUnfilteredChildren(const std::vector<Filter>& filters, const EngravingItem* target) const;
     void filterChildren(UndoCommand::Filter f, EngravingItem* target);
@@ -198,6 +202,9 @@ protected:
     virtual void flip(EditData*) {}
     void appendChildren(UndoCommand& other);
 
+    static size_t objectFootprint(const EngravingObject* object);
+    static size_t scoreFootprint(const Score* score);
+
 private:
     std::vector<UndoCommand*> m_childCommands;
 };
@@ -248,6 +255,8 @@ public:
 
     static bool canRecordSelectedElement(const EngravingItem* e);
 
+    size_t memoryFootprint() const override;
+
     UNDO_NAME("UndoMacro")
 
 private:
@@ -281,7 +290,7 @@ public:
     void pushWithoutPerforming(UndoCommand*);
     void pop();
 
-    bool canUndo() const { return m_currentIndex > 0; }
+    bool canUndo() const { return m_currentIndex > m_droppedCount; }
     bool canRedo() const { return m_currentIndex < m_macroList.size(); }
     bool isClean() const { return m_cleanState == m_stateList[m_currentIndex]; }
 
@@ -309,15 +318,33 @@ public:
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(m_currentIndex); }
 
+    /// Approximate memory kept alive by the undo history, in bytes
+    size_t memoryFootprint() const { return m_footprint; }
+
+    /// When the history exceeds the budget (in bytes), the oldest macros are dropped
+    /// and can't be undone anymore. 0 means no limit
+    size_t memoryBudget() const { return m_memoryBudget; }
+    void setMemoryBudget(size_t bytes);
+
+    /// Number of the oldest macros dropped to respect the memory budget.
+    /// Their indices stay valid, but lastAtIndex() returns nullptr for them
+    size_t droppedCount() const { return m_droppedCount; }
+
 private:
     void remove(size_t idx);
+    void takeLastMacro(bool undo);
+    void applyMemoryBudget();
 
     UndoMacro* m_activeCommand = nullptr;
     std::vector<UndoMacro*> m_macroList;
+    std::vector<size_t> m_footprintList;
     std::vector<int> m_stateList;
     int m_nextState = 0;
     int m_cleanState = 0;
     size_t m_currentIndex = 0;
+    size_t m_droppedCount = 0;
+    size_t m_footprint = 0;
+    size_t m_memoryBudget = 0;
     bool m_isLocked = false;
 };
 
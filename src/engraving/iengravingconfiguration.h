@@ -130,6 +130,21 @@ public:
     virtual bool doNotSaveEIDsForBackCompat() const = 0;
     virtual void setDoNotSaveEIDsForBackCompat(bool doNotSave) = 0;
 
+    /// Memory (in bytes) the undo history may use before its oldest entries are dropped, 0 is unlimited
+    virtual size_t undoMemoryBudget() const = 0;
+
+    /// Whether the part scores of a file are read concurrently
+    virtual bool parallelExcerptsReading() const = 0;
+
+    /// Whether part scores are read only when they are first opened, exported or edited
+    virtual bool deferredExcerptsReading() const = 0;
+
+    /// Whether the staves of a score are rendered to MIDI events concurrently
+    virtual bool parallelMidiRendering() const = 0;
+
+    /// Whether score changes only re-render the playback events and dynamics they can affect
+    virtual bool incrementalPlaybackUpdate() const = 0;
+
     virtual bool allowReadingImagesFromOutsideMscz() const = 0;
 
     /// these configurations will be removed after solving https://github.com/musescore/MuseScore/issues/14294
@@ -30,12 +30,21 @@ using namespace mu::engraving;
 
 EID EIDRegister::newEIDForItem(const EngravingObject* item)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     EID eid = MScore::testMode ? EID::newUniqueTestMode(m_maxValTestMode) : EID::newUnique();
-    registerItemEID(eid, const_cast<EngravingObject*>(item));
+    doRegisterItemEID(eid, const_cast<EngravingObject*>(item));
     return eid;
 }
 
 void EIDRegister::registerItemEID(const EID& eid, const EngravingObject* item)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    doRegisterItemEID(eid, item);
+}
+
+void EIDRegister::doRegisterItemEID(const EID& eid, const EngravingObject* item)
 {
     IF_ASSERT_FAILED(eid.isValid() && item) {
         return;
@@ -60,6 +69,8 @@ void EIDRegister::removeItem(const EngravingObject* item)
 {
     // NOTE: needed only when elements are removed during read (e.g. broken spanners)
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     auto itemIter = m_itemToEid.find(const_cast<EngravingObject*>(item));
     IF_ASSERT_FAILED(itemIter != m_itemToEid.end()) {
         return;
@@ -78,6 +89,8 @@ void EIDRegister::removeItem(const EngravingObject* item)
 
 EngravingObject* EIDRegister::itemFromEID(const EID& eid) const
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     auto iter = m_eidToItem.find(eid);
     IF_ASSERT_FAILED(iter != m_eidToItem.end()) {
         return nullptr;
@@ -87,6 +100,8 @@ EngravingObject* EIDRegister::itemFromEID(const EID& eid) const
 
 EID EIDRegister::EIDFromItem(const EngravingObject* item) const
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     auto iter = m_itemToEid.find(const_cast<EngravingObject*>(item));
     return iter == m_itemToEid.end() ? EID::invalid() : iter->second;
 }
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 
 #include "eid.h"
@@ -45,6 +46,10 @@ public:
 private:
     EIDRegister(const EIDRegister&) = delete;
 
+    void doRegisterItemEID(const EID& eid, const EngravingObject* item);
+
+    //! NOTE Part scores register their items concurrently when they are read in parallel
+    mutable std::mutex m_mutex;
     std::unordered_map<EID, EngravingObject*> m_eidToItem;
     std::unordered_map<EngravingObject*, EID> m_itemToEid;
 
@@ -0,0 +1,280 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_INTERVALINDEX_H
+#define MU_ENGRAVING_INTERVALINDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "engraving/thirdparty/intervaltree/IntervalTree.h"
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   IntervalIndex
+//    Dynamic counterpart of interval_tree::IntervalTree.
+//    A treap ordered by (start, id) where every node also
+//    keeps the biggest stop of its subtree, so single
+//    intervals can be inserted and removed in O(log n)
+//    and queries don't require rebuilding anything.
+//    The id must be unique among the stored intervals.
+//---------------------------------------------------------
+
+template<typename Value, class Scalar = int>
+class IntervalIndex
+{
+public:
+    using Interval = interval_tree::Interval<Value, Scalar>;
+    using IntervalList = std::vector<Interval>;
+    using Id = uint64_t;
+
+    bool empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+
+    void clear()
+    {
+        m_nodes.clear();
+        m_freeNodes.clear();
+        m_root = NO_NODE;
+        m_size = 0;
+    }
+
+    void insert(const Interval& interval, Id id)
+    {
+        int node = createNode(interval, id);
+        int left = NO_NODE;
+        int right = NO_NODE;
+        split(m_root, interval.start, id, left, right);
+        m_root = merge(merge(left, node), right);
+        ++m_size;
+    }
+
+    bool remove(const Scalar& start, Id id)
+    {
+        bool removed = false;
+        m_root = remove(m_root, start, id, removed);
+        if (removed) {
+            --m_size;
+        }
+        return removed;
+    }
+
+    // Call f on all intervals overlapping [start, stop], ordered by start
+    template<class UnaryFunction>
+    void visitOverlapping(const Scalar& start, const Scalar& stop, UnaryFunction f) const
+    {
+        visitOverlapping(m_root, start, stop, f);
+    }
+
+    // Call f on all intervals contained within [start, stop], ordered by start
+    template<class UnaryFunction>
+    void visitContained(const Scalar& start, const Scalar& stop, UnaryFunction f) const
+    {
+        visitContained(m_root, start, stop, f);
+    }
+
+    IntervalList findOverlapping(const Scalar& start, const Scalar& stop) const
+    {
+        IntervalList result;
+        visitOverlapping(start, stop, [&result](const Interval& interval) {
+            result.push_back(interval);
+        });
+        return result;
+    }
+
+    IntervalList findContained(const Scalar& start, const Scalar& stop) const
+    {
+        IntervalList result;
+        visitContained(start, stop, [&result](const Interval& interval) {
+            result.push_back(interval);
+        });
+        return result;
+    }
+
+private:
+    static constexpr int NO_NODE = -1;
+
+    struct Node {
+        Interval interval;
+        Id id = 0;
+        Scalar maxStop;
+        uint32_t priority = 0;
+        int left = NO_NODE;
+        int right = NO_NODE;
+
+        Node(const Interval& i, Id nodeId, uint32_t p)
+            : interval(i), id(nodeId), maxStop(i.stop), priority(p) {}
+    };
+
+    static bool less(const Scalar& start1, Id id1, const Scalar& start2, Id id2)
+    {
+        return start1 < start2 || (start1 == start2 && id1 < id2);
+    }
+
+    uint32_t nextPriority()
+    {
+        // xorshift, good enough to keep the treap balanced
+        m_seed ^= m_seed << 13;
+        m_seed ^= m_seed >> 17;
+        m_seed ^= m_seed << 5;
+        return m_seed;
+    }
+
+    int createNode(const Interval& interval, Id id)
+    {
+        if (!m_freeNodes.empty()) {
+            int node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+            m_nodes[node] = Node(interval, id, nextPriority());
+            return node;
+        }
+
+        m_nodes.emplace_back(interval, id, nextPriority());
+        return static_cast<int>(m_nodes.size()) - 1;
+    }
+
+    void update(int node)
+    {
+        Node& n = m_nodes[node];
+        n.maxStop = n.interval.stop;
+        if (n.left != NO_NODE) {
+            n.maxStop = std::max(n.maxStop, m_nodes[n.left].maxStop);
+        }
+        if (n.right != NO_NODE) {
+            n.maxStop = std::max(n.maxStop, m_nodes[n.right].maxStop);
+        }
+    }
+
+    // left receives the nodes ordered before (start, id), right the rest
+    void split(int node, const Scalar& start, Id id, int& left, int& right)
+    {
+        if (node == NO_NODE) {
+            left = right = NO_NODE;
+            return;
+        }
+
+        Node& n = m_nodes[node];
+        if (less(n.interval.start, n.id, start, id)) {
+            split(n.right, start, id, m_nodes[node].right, right);
+            left = node;
+        } else {
+            split(n.left, start, id, left, m_nodes[node].left);
+            right = node;
+        }
+        update(node);
+    }
+
+    int merge(int left, int right)
+    {
+        if (left == NO_NODE) {
+            return right;
+        }
+        if (right == NO_NODE) {
+            return left;
+        }
+
+        if (m_nodes[left].priority > m_nodes[right].priority) {
+            int merged = merge(m_nodes[left].right, right);
+            m_nodes[left].right = merged;
+            update(left);
+            return left;
+        }
+
+        int merged = merge(left, m_nodes[right].left);
+        m_nodes[right].left = merged;
+        update(right);
+        return right;
+    }
+
+    int remove(int node, const Scalar& start, Id id, bool& removed)
+    {
+        if (node == NO_NODE) {
+            return NO_NODE;
+        }
+
+        Node& n = m_nodes[node];
+        if (n.interval.start == start && n.id == id) {
+            int merged = merge(n.left, n.right);
+            m_freeNodes.push_back(node);
+            removed = true;
+            return merged;
+        }
+
+        if (less(start, id, n.interval.start, n.id)) {
+            int child = remove(n.left, start, id, removed);
+            m_nodes[node].left = child;
+        } else {
+            int child = remove(n.right, start, id, removed);
+            m_nodes[node].right = child;
+        }
+        update(node);
+        return node;
+    }
+
+    template<class UnaryFunction>
+    void visitOverlapping(int node, const Scalar& start, const Scalar& stop, UnaryFunction& f) const
+    {
+        if (node == NO_NODE || m_nodes[node].maxStop < start) {
+            return;
+        }
+
+        const Node& n = m_nodes[node];
+        visitOverlapping(n.left, start, stop, f);
+        if (n.interval.start > stop) {
+            return;
+        }
+        if (n.interval.stop >= start) {
+            f(n.interval);
+        }
+        visitOverlapping(n.right, start, stop, f);
+    }
+
+    template<class UnaryFunction>
+    void visitContained(int node, const Scalar& start, const Scalar& stop, UnaryFunction& f) const
+    {
+        if (node == NO_NODE || m_nodes[node].maxStop < start) {
+            return;
+        }
+
+        const Node& n = m_nodes[node];
+        if (n.interval.start >= start) {
+            visitContained(n.left, start, stop, f);
+        }
+        if (n.interval.start > stop) {
+            return;
+        }
+        if (start <= n.interval.start && n.interval.stop <= stop) {
+            f(n.interval);
+        }
+        visitContained(n.right, start, stop, f);
+    }
+
+    std::vector<Node> m_nodes;
+    std::vector<int> m_freeNodes;
+    int m_root = NO_NODE;
+    size_t m_size = 0;
+    uint32_t m_seed = 2463534242u;
+};
+} // namespace mu::engraving
+
+#endif // MU_ENGRAVING_INTERVALINDEX_H
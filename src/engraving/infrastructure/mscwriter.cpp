@@ -101,6 +101,11 @@ bool MscWriter::hasError() const
 MscWriter::IWriter* MscWriter::writer() const
 {
     if (!m_writer) {
+        if (m_params.snapshot) {
+            m_writer = new SnapshotWriter(&m_snapshot);
+            return m_writer;
+        }
+
         switch (m_params.mode) {
         case MscIoMode::Zip:
             m_writer = new ZipFileWriter();
@@ -208,6 +213,44 @@ void MscWriter::writeAutomationJsonFile(const muse::ByteArray& data)
     addFileData(u"automation.json", data);
 }
 
+MscWriter::Snapshot MscWriter::takeSnapshot()
+{
+    IF_ASSERT_FAILED(m_params.snapshot && !isOpened()) {
+        return {};
+    }
+
+    return std::move(m_snapshot);
+}
+
+Ret MscWriter::writeSnapshot(const Params& params, const Snapshot& snapshot)
+{
+    Params writeParams = params;
+    writeParams.snapshot = false;
+
+    MscWriter writer(writeParams);
+    Ret ret = writer.open();
+    if (!ret) {
+        return ret;
+    }
+
+    // the snapshot already contains the container file
+    writer.m_meta.isWritten = true;
+
+    for (const FileData& file : snapshot) {
+        if (!writer.addFileData(file.fileName, file.data)) {
+            return make_ret(Ret::Code::UnknownError);
+        }
+    }
+
+    writer.close();
+
+    if (writer.hasError()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    return make_ok();
+}
+
 void MscWriter::writeMeta()
 {
     if (m_meta.isWritten) {
@@ -389,6 +432,39 @@ bool MscWriter::DirWriter::addFileData(const String& fileName, const ByteArray&
     return true;
 }
 
+MscWriter::SnapshotWriter::SnapshotWriter(Snapshot* snapshot)
+    : m_snapshot(snapshot)
+{
+}
+
+Ret MscWriter::SnapshotWriter::open(io::IODevice*, const path_t&)
+{
+    m_snapshot->clear();
+    m_isOpened = true;
+    return true;
+}
+
+void MscWriter::SnapshotWriter::close()
+{
+    m_isOpened = false;
+}
+
+bool MscWriter::SnapshotWriter::isOpened() const
+{
+    return m_isOpened;
+}
+
+bool MscWriter::SnapshotWriter::hasError() const
+{
+    return false;
+}
+
+bool MscWriter::SnapshotWriter::addFileData(const String& fileName, const ByteArray& data)
+{
+    m_snapshot->push_back({ fileName, data });
+    return true;
+}
+
 MscWriter::XmlFileWriter::~XmlFileWriter()
 {
     delete m_stream;
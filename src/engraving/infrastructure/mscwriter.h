@@ -21,6 +21,9 @@
  */
 #pragma once
 
+#include <vector>
+
+#include "types/bytearray.h"
 #include "types/string.h"
 #include "types/ret.h"
 #include "io/path.h"
@@ -43,8 +46,19 @@ public:
         muse::io::path_t filePath;
         muse::String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+
+        //! NOTE If set, the files are only collected in memory,
+        //! see takeSnapshot and writeSnapshot
+        bool snapshot = false;
+    };
+
+    struct FileData {
+        muse::String fileName;
+        muse::ByteArray data;
     };
 
+    using Snapshot = std::vector<FileData>;
+
     MscWriter() = default;
     MscWriter(const Params& params);
     ~MscWriter();
@@ -69,6 +83,12 @@ public:
     void writeViewSettingsJsonFile(const muse::ByteArray& data, const muse::io::path_t& pathPrefix = "");
     void writeAutomationJsonFile(const muse::ByteArray& data);
 
+    //! NOTE Files collected in snapshot mode, available after close.
+    //! The snapshot doesn't refer to the score anymore, so it can be
+    //! written by writeSnapshot on another thread (compression and disk IO)
+    Snapshot takeSnapshot();
+    static muse::Ret writeSnapshot(const Params& params, const Snapshot& snapshot);
+
 private:
 
     struct IWriter {
@@ -120,6 +140,19 @@ private:
         muse::TextStream* m_stream = nullptr;
     };
 
+    struct SnapshotWriter : public IWriter
+    {
+        SnapshotWriter(Snapshot* snapshot);
+        muse::Ret open(muse::io::IODevice* device, const muse::io::path_t& filePath) override;
+        void close() override;
+        bool isOpened() const override;
+        bool hasError() const override;
+        bool addFileData(const muse::String& fileName, const muse::ByteArray& data) override;
+    private:
+        Snapshot* m_snapshot = nullptr;
+        bool m_isOpened = false;
+    };
+
     struct Meta {
         std::vector<muse::String> files;
         bool isWritten = false;
@@ -141,5 +174,6 @@ private:
     mutable IWriter* m_writer = nullptr;
     Meta m_meta;
     bool m_hadError = false;
+    Snapshot m_snapshot;
 };
 }
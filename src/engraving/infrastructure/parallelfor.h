@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   parallelFor
+//    Calls f(idx) for every idx in [0, count) on up to
+//    hardware_concurrency() threads, the calling thread
+//    included. The threads take the next index from a
+//    shared counter, so slow items don't hold up the others.
+//    Returns when all calls are done, the callers collect
+//    the results in index order.
+//---------------------------------------------------------
+
+template<class Function>
+void parallelFor(size_t count, Function f)
+{
+    std::atomic<size_t> nextIdx = 0;
+    auto processQueued = [&f, &nextIdx, count]() {
+        for (size_t idx = nextIdx++; idx < count; idx = nextIdx++) {
+            f(idx);
+        }
+    };
+
+    const size_t threads = std::min(count, static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency())));
+    std::vector<std::future<void> > futures;
+    for (size_t i = 1; i < threads; ++i) {
+        futures.push_back(std::async(std::launch::async, processQueued));
+    }
+
+    processQueued();
+    for (std::future<void>& future : futures) {
+        future.get();
+    }
+}
+}
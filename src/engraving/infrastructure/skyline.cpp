@@ -22,6 +22,10 @@
 
 #include "skyline.h"
 
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
 #include "realfn.h"
 #include "draw/painter.h"
 
@@ -37,6 +41,109 @@ using namespace mu;
 using namespace muse::draw;
 
 namespace mu::engraving {
+//---------------------------------------------------------
+//   SkylineEnvelope
+//    Sweeps the elements from left to right, keeping the
+//    elements that cover the current x in a heap ordered by
+//    their vertical edge. Elements that are left behind are
+//    dropped lazily when they reach the top of the heap.
+//---------------------------------------------------------
+
+SkylineEnvelope::SkylineEnvelope(const std::vector<ShapeElement>& elements, bool isNorth, double padding)
+{
+    struct Edge {
+        double x1 = 0.0;
+        double x2 = 0.0;
+        double y = 0.0;
+    };
+
+    std::vector<Edge> edges;
+    edges.reserve(elements.size());
+    for (const ShapeElement& el : elements) {
+        // same filtering as Shape::minVerticalDistance and mu::engraving::intersects
+        if (el.height() <= 0.0 || el.width() == 0.0) {
+            continue;
+        }
+        if (!(el.width() > 0.0) || !std::isfinite(el.left()) || !std::isfinite(el.right())
+            || !std::isfinite(el.top()) || !std::isfinite(el.bottom())) {
+            m_irregular = true;
+            m_steps.clear();
+            return;
+        }
+        // north keeps the topmost edge, south the bottommost one: store both as "bigger is higher priority"
+        edges.push_back({ el.left() - padding, el.right() + padding, isNorth ? -el.top() : el.bottom() });
+    }
+
+    if (edges.empty()) {
+        return;
+    }
+
+    std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) { return a.x1 < b.x1; });
+
+    std::vector<double> xs;
+    xs.reserve(edges.size() * 2);
+    for (const Edge& e : edges) {
+        xs.push_back(e.x1);
+        xs.push_back(e.x2);
+    }
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+
+    auto lowerPriority = [](const Edge& a, const Edge& b) { return a.y < b.y; };
+    std::priority_queue<Edge, std::vector<Edge>, decltype(lowerPriority)> active(lowerPriority);
+
+    size_t next = 0;
+    for (size_t i = 0; i + 1 < xs.size(); ++i) {
+        double x = xs[i];
+        while (next < edges.size() && edges[next].x1 <= x) {
+            active.push(edges[next]);
+            ++next;
+        }
+        while (!active.empty() && active.top().x2 <= x) {
+            active.pop();
+        }
+        if (active.empty()) {
+            continue;
+        }
+
+        double y = isNorth ? -active.top().y : active.top().y;
+        if (!m_steps.empty() && m_steps.back().x2 == x && m_steps.back().y == y) {
+            m_steps.back().x2 = xs[i + 1];
+        } else {
+            m_steps.push_back({ x, xs[i + 1], y });
+        }
+    }
+}
+
+//-------------------------------------------------------------------
+//   minDistance
+//    north is located below south.
+//    Steps of each envelope are disjoint and sorted, so a single
+//    merge walk visits every pair of overlapping steps.
+//-------------------------------------------------------------------
+
+double SkylineEnvelope::minDistance(const SkylineEnvelope& south, const SkylineEnvelope& north)
+{
+    double dist = -DBL_MAX; // min real
+
+    const std::vector<Step>& a = south.m_steps;
+    const std::vector<Step>& b = north.m_steps;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a.size() && j < b.size()) {
+        if (a[i].x1 < b[j].x2 && b[j].x1 < a[i].x2) {
+            dist = std::max(dist, a[i].y - b[j].y);
+        }
+        if (a[i].x2 < b[j].x2) {
+            ++i;
+        } else {
+            ++j;
+        }
+    }
+
+    return dist;
+}
+
 void Skyline::add(const ShapeElement& r)
 {
     if (r.ignoreForLayout()) {
@@ -103,6 +210,7 @@ SkylineLine SkylineLine::getFilteredCopy(std::function<bool(const ShapeElement&)
     SkylineLine newSkylineLine(*this);
 
     newSkylineLine.m_shape.clear();
+    newSkylineLine.invalidateEnvelope();
 
     for (const ShapeElement& shapeEl : m_shape.elements()) {
         if (filterOut(shapeEl)) {
@@ -140,6 +248,7 @@ void SkylineLine::add(const ShapeElement& r)
     }
 
     m_shape.add(r);
+    invalidateEnvelope();
 }
 
 double SkylineLine::staffLinesTopAtX(double x) const
@@ -187,6 +296,17 @@ void SkylineLine::clear()
 {
     m_staffLineEdges.clear();
     m_shape.clear();
+    invalidateEnvelope();
+}
+
+const SkylineEnvelope& SkylineLine::envelope(double padding) const
+{
+    if (!m_envelopeValid || m_envelopePadding != padding) {
+        m_envelope = SkylineEnvelope(m_shape.elements(), m_isNorth, padding);
+        m_envelopePadding = padding;
+        m_envelopeValid = true;
+    }
+    return m_envelope;
 }
 
 //-------------------------------------------------------------------
@@ -202,17 +322,47 @@ double Skyline::minDistance(const Skyline& s, double minHorizontalClearance) con
 
 double SkylineLine::minDistance(const SkylineLine& sl, double minHorizontalClearance) const
 {
-    return m_shape.minVerticalDistance(sl.m_shape, minHorizontalClearance);
+    if (m_shape.empty() || sl.m_shape.empty()) {
+        return 0.0;
+    }
+
+    const SkylineEnvelope& south = envelope(minHorizontalClearance);
+    const SkylineEnvelope& north = sl.envelope();
+    if (south.irregular() || north.irregular()) {
+        return m_shape.minVerticalDistance(sl.m_shape, minHorizontalClearance);
+    }
+
+    return SkylineEnvelope::minDistance(south, north);
 }
 
 double SkylineLine::minDistanceToShapeAbove(const Shape& shapeAbove, double minHorizontalClearance) const
 {
-    return shapeAbove.minVerticalDistance(m_shape, minHorizontalClearance);
+    if (m_shape.empty() || shapeAbove.empty()) {
+        return 0.0;
+    }
+
+    SkylineEnvelope south(shapeAbove.elements(), false, minHorizontalClearance);
+    const SkylineEnvelope& north = envelope();
+    if (south.irregular() || north.irregular()) {
+        return shapeAbove.minVerticalDistance(m_shape, minHorizontalClearance);
+    }
+
+    return SkylineEnvelope::minDistance(south, north);
 }
 
 double SkylineLine::minDistanceToShapeBelow(const Shape& shapeBelow, double minHorizontalClearance) const
 {
-    return m_shape.minVerticalDistance(shapeBelow, minHorizontalClearance);
+    if (m_shape.empty() || shapeBelow.empty()) {
+        return 0.0;
+    }
+
+    const SkylineEnvelope& south = envelope(minHorizontalClearance);
+    SkylineEnvelope north(shapeBelow.elements(), true);
+    if (south.irregular() || north.irregular()) {
+        return m_shape.minVerticalDistance(shapeBelow, minHorizontalClearance);
+    }
+
+    return SkylineEnvelope::minDistance(south, north);
 }
 
 double SkylineLine::verticalClearanceAbove(const Shape& shapeAbove) const
@@ -268,6 +418,7 @@ bool SkylineLine::valid() const
 SkylineLine& SkylineLine::translateY(double y)
 {
     m_shape.translateY(y);
+    invalidateEnvelope();
     return *this;
 }
 
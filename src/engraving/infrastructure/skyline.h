@@ -37,6 +37,40 @@ class Painter;
 namespace mu::engraving {
 class Segment;
 
+//---------------------------------------------------------
+//   SkylineEnvelope
+//    Piecewise constant outline of a set of shape elements,
+//    sorted by x. Each step holds the lowest bottom edge (south)
+//    or the highest top edge (north) over its x range. If some
+//    element cannot be merged into steps (negative or non-finite
+//    width), the envelope is marked as irregular and callers must
+//    fall back to comparing elements one by one.
+//---------------------------------------------------------
+
+class SkylineEnvelope
+{
+public:
+    struct Step {
+        double x1 = 0.0;
+        double x2 = 0.0;
+        double y = 0.0;
+    };
+
+    SkylineEnvelope() = default;
+    SkylineEnvelope(const std::vector<ShapeElement>& elements, bool isNorth, double padding = 0.0);
+
+    const std::vector<Step>& steps() const { return m_steps; }
+    bool irregular() const { return m_irregular; }
+
+    // south is located above north. The padding of the south envelope
+    // plays the role of minHorizontalClearance in Shape::minVerticalDistance
+    static double minDistance(const SkylineEnvelope& south, const SkylineEnvelope& north);
+
+private:
+    std::vector<Step> m_steps;
+    bool m_irregular = false;
+};
+
 //---------------------------------------------------------
 //   SkylineLine
 //---------------------------------------------------------
@@ -52,7 +86,11 @@ public:
     void add(const Shape& s);
 
     template<typename Predicate>
-    inline bool remove_if(Predicate p) { return m_shape.remove_if(p); }
+    inline bool remove_if(Predicate p)
+    {
+        invalidateEnvelope();
+        return m_shape.remove_if(p);
+    }
     SkylineLine getFilteredCopy(std::function<bool(const ShapeElement&)> filterOut) const;
 
     void clear();
@@ -74,16 +112,28 @@ public:
     bool isNorth() const { return m_isNorth; }
 
     const std::vector<ShapeElement>& elements() const { return m_shape.elements(); }
-    std::vector<ShapeElement>& elements() { return m_shape.elements(); }
+    std::vector<ShapeElement>& elements()
+    {
+        invalidateEnvelope();
+        return m_shape.elements();
+    }
+
+    const SkylineEnvelope& envelope(double padding = 0.0) const;
 
 private:
     double staffLinesTopAtX(double x) const;
     double staffLinesBottomAtX(double x) const;
 
+    void invalidateEnvelope() { m_envelopeValid = false; }
+
 private:
     const bool m_isNorth;
     Shape m_shape;
 
+    mutable SkylineEnvelope m_envelope;   // cache
+    mutable double m_envelopePadding = 0.0;
+    mutable bool m_envelopeValid = false;
+
     struct StaffLineEdge {
         double top = 0.0;
         double bottom = 0.0;
@@ -55,6 +55,15 @@ static const Settings::Key FRETBOARD_DIAGRAMS_AUTO_UPDATE("engraving", "score/fr
 
 static const Settings::Key DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT("engraving", "engraving/compat/doNotSaveEIDsForBackCompat");
 
+static const Settings::Key UNDO_MEMORY_BUDGET_MB("engraving", "engraving/undo/memoryBudgetMB");
+
+static const Settings::Key PARALLEL_EXCERPTS_READING("engraving", "engraving/read/parallelExcerpts");
+static const Settings::Key DEFERRED_EXCERPTS_READING("engraving", "engraving/read/deferredExcerpts");
+
+static const Settings::Key PARALLEL_MIDI_RENDERING("engraving", "engraving/midi/parallelRendering");
+
+static const Settings::Key INCREMENTAL_PLAYBACK_UPDATE("engraving", "engraving/playback/incrementalUpdate");
+
 struct VoiceColor {
     Settings::Key key;
     Color color;
@@ -157,6 +166,26 @@ void EngravingConfiguration::init()
     settings()->setDefaultValue(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, Val(false));
     settings()->setDescription(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, muse::trc("engraving", "Do not save EIDs"));
     settings()->setCanBeManuallyEdited(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, false);
+
+    settings()->setDefaultValue(UNDO_MEMORY_BUDGET_MB, Val(0));
+    settings()->setDescription(UNDO_MEMORY_BUDGET_MB, muse::trc("engraving", "Undo history memory budget (MB, 0 is unlimited)"));
+    settings()->setCanBeManuallyEdited(UNDO_MEMORY_BUDGET_MB, true);
+
+    settings()->setDefaultValue(PARALLEL_EXCERPTS_READING, Val(false));
+    settings()->setDescription(PARALLEL_EXCERPTS_READING, muse::trc("engraving", "Read parts in parallel"));
+    settings()->setCanBeManuallyEdited(PARALLEL_EXCERPTS_READING, true);
+
+    settings()->setDefaultValue(DEFERRED_EXCERPTS_READING, Val(false));
+    settings()->setDescription(DEFERRED_EXCERPTS_READING, muse::trc("engraving", "Read parts when they are first used"));
+    settings()->setCanBeManuallyEdited(DEFERRED_EXCERPTS_READING, true);
+
+    settings()->setDefaultValue(PARALLEL_MIDI_RENDERING, Val(false));
+    settings()->setDescription(PARALLEL_MIDI_RENDERING, muse::trc("engraving", "Render staves to MIDI in parallel"));
+    settings()->setCanBeManuallyEdited(PARALLEL_MIDI_RENDERING, true);
+
+    settings()->setDefaultValue(INCREMENTAL_PLAYBACK_UPDATE, Val(false));
+    settings()->setDescription(INCREMENTAL_PLAYBACK_UPDATE, muse::trc("engraving", "Update playback only where the score has changed"));
+    settings()->setCanBeManuallyEdited(INCREMENTAL_PLAYBACK_UPDATE, true);
 }
 
 muse::io::path_t EngravingConfiguration::appDataPath() const
@@ -435,6 +464,32 @@ void EngravingConfiguration::setDoNotSaveEIDsForBackCompat(bool doNotSave)
     settings()->setSharedValue(DO_NOT_SAVE_EIDS_FOR_BACK_COMPAT, Val(doNotSave));
 }
 
+size_t EngravingConfiguration::undoMemoryBudget() const
+{
+    int megabytes = settings()->value(UNDO_MEMORY_BUDGET_MB).toInt();
+    return megabytes > 0 ? static_cast<size_t>(megabytes) * 1024 * 1024 : 0;
+}
+
+bool EngravingConfiguration::parallelExcerptsReading() const
+{
+    return settings()->value(PARALLEL_EXCERPTS_READING).toBool();
+}
+
+bool EngravingConfiguration::deferredExcerptsReading() const
+{
+    return settings()->value(DEFERRED_EXCERPTS_READING).toBool();
+}
+
+bool EngravingConfiguration::parallelMidiRendering() const
+{
+    return settings()->value(PARALLEL_MIDI_RENDERING).toBool();
+}
+
+bool EngravingConfiguration::incrementalPlaybackUpdate() const
+{
+    return settings()->value(INCREMENTAL_PLAYBACK_UPDATE).toBool();
+}
+
 bool EngravingConfiguration::allowReadingImagesFromOutsideMscz() const
 {
     return false;
@@ -106,6 +106,15 @@ public:
     bool doNotSaveEIDsForBackCompat() const override;
     void setDoNotSaveEIDsForBackCompat(bool doNotSave) override;
 
+    size_t undoMemoryBudget() const override;
+
+    bool parallelExcerptsReading() const override;
+    bool deferredExcerptsReading() const override;
+
+    bool parallelMidiRendering() const override;
+
+    bool incrementalPlaybackUpdate() const override;
+
     bool allowReadingImagesFromOutsideMscz() const override;
 
     bool guitarProImportExperimental() const override;
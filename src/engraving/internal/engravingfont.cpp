@@ -21,8 +21,14 @@
  */
 #include "engravingfont.h"
 
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <typeinfo>
+
 #include "engraving/dom/mscore.h"
 #include "serialization/json.h"
+#include "io/buffer.h"
 #include "io/file.h"
 #include "draw/painter.h"
 #include "types/symnames.h"
@@ -120,6 +126,14 @@ void EngravingFont::ensureLoad()
 
     m_font.setPointSizeF(DEFAULT_SMUFL_POINT_SIZE());
 
+    const path_t cachePath = metricsCachePath();
+    const uint64_t cacheKey = cachePath.empty() ? 0 : metricsCacheKey();
+    if (cacheKey != 0 && readMetricsCache(cachePath, cacheKey)) {
+        m_loadedFromMetricsCache = true;
+        m_loaded = true;
+        return;
+    }
+
     for (size_t id = 0; id < m_symbols.size(); ++id) {
         Smufl::Code code = Smufl::code(static_cast<SymId>(id));
         if (!code.isValid()) {
@@ -151,6 +165,10 @@ void EngravingFont::ensureLoad()
     loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
     loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
 
+    if (cacheKey != 0) {
+        writeMetricsCache(cachePath, cacheKey);
+    }
+
     m_loaded = true;
 }
 
@@ -864,6 +882,338 @@ void EngravingFont::computeMetrics(EngravingFont::Sym& sym, const Smufl::Code& c
     }
 }
 
+// =============================================
+// Metrics cache
+// =============================================
+
+//! NOTE Computing the metrics of all symbols through the font provider and parsing
+//! the metadata is the most expensive part of loading a font, and it gives the same
+//! result every time for the same files and font provider. So the result is kept
+//! in a binary file, keyed by a hash of the cache version, the provider and the path,
+//! size and modification time of the font and metadata files.
+//! Increase the version if the format or the computation of the metrics changes.
+
+static constexpr uint32_t METRICS_CACHE_MAGIC = 0x4D46534D; // MSFM
+static constexpr uint32_t METRICS_CACHE_VERSION = 1;
+
+enum class CachedValueType : uint8_t {
+    Real,
+    Bool,
+    String
+};
+
+namespace {
+class MetricsCacheWriter
+{
+public:
+    MetricsCacheWriter(ByteArray* data)
+        : m_buf(Buffer::opened(IODevice::WriteOnly, data)) {}
+
+    template<typename T>
+    void write(const T& v)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        m_buf.write(reinterpret_cast<const uint8_t*>(&v), sizeof(T));
+    }
+
+    void write(const RectF& r)
+    {
+        write(r.x());
+        write(r.y());
+        write(r.width());
+        write(r.height());
+    }
+
+    void write(const String& str)
+    {
+        ByteArray utf8 = str.toUtf8();
+        write(static_cast<uint32_t>(utf8.size()));
+        m_buf.write(reinterpret_cast<const uint8_t*>(utf8.constData()), utf8.size());
+    }
+
+private:
+    Buffer m_buf;
+};
+
+class MetricsCacheReader
+{
+public:
+    MetricsCacheReader(const ByteArray& data)
+        : m_pos(reinterpret_cast<const uint8_t*>(data.constData())), m_end(m_pos + data.size()) {}
+
+    bool ok() const { return m_ok; }
+
+    template<typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T v {};
+        if (!m_ok || size_t(m_end - m_pos) < sizeof(T)) {
+            m_ok = false;
+            return v;
+        }
+        std::memcpy(&v, m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return v;
+    }
+
+    RectF readRect()
+    {
+        double x = read<double>();
+        double y = read<double>();
+        double w = read<double>();
+        double h = read<double>();
+        return RectF(x, y, w, h);
+    }
+
+    String readString()
+    {
+        uint32_t size = read<uint32_t>();
+        if (!m_ok || size_t(m_end - m_pos) < size) {
+            m_ok = false;
+            return String();
+        }
+        String str = String::fromUtf8(reinterpret_cast<const char*>(m_pos), size);
+        m_pos += size;
+        return str;
+    }
+
+private:
+    const uint8_t* m_pos = nullptr;
+    const uint8_t* m_end = nullptr;
+    bool m_ok = true;
+};
+}
+
+static void hashData(uint64_t& hash, const uint8_t* bytes, size_t size)
+{
+    // FNV-1a
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+static void hashData(uint64_t& hash, const std::string& str)
+{
+    hashData(hash, reinterpret_cast<const uint8_t*>(str.data()), str.size());
+}
+
+template<typename T>
+static void hashData(uint64_t& hash, const T& v)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    hashData(hash, reinterpret_cast<const uint8_t*>(&v), sizeof(T));
+}
+
+path_t EngravingFont::metricsCachePath() const
+{
+    if (!configuration()) {
+        return path_t();
+    }
+
+    path_t appDataPath = configuration()->appDataPath();
+    if (appDataPath.empty()) {
+        return path_t();
+    }
+
+    return appDataPath + "/fontmetrics/" + m_name + ".bin";
+}
+
+uint64_t EngravingFont::metricsCacheKey() const
+{
+    if (!fileSystem()) {
+        return 0;
+    }
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hashData(hash, METRICS_CACHE_VERSION);
+
+    //! NOTE The metrics are computed by the font provider, other implementations may give other results
+    hashData(hash, std::string(fontProvider() ? typeid(*fontProvider()).name() : ""));
+
+    //! NOTE Reading the files just to hash them would cost about as much as the cache saves,
+    //! so a file counts as unchanged while its size and modification time are the same
+    for (const path_t& path : { m_fontPath, m_metadataPath }) {
+        RetVal<uint64_t> size = fileSystem()->fileSize(path);
+        if (!size.ret) {
+            return 0;
+        }
+
+        hashData(hash, path.toStdString());
+        hashData(hash, size.val);
+        hashData(hash, fileSystem()->lastModified(path).toString(DateFormat::ISODate).toStdString());
+    }
+
+    return hash != 0 ? hash : 1;
+}
+
+bool EngravingFont::readMetricsCache(const path_t& cachePath, uint64_t key)
+{
+    TRACEFUNC;
+
+    ByteArray data;
+    if (!File::exists(cachePath) || !File::readFile(cachePath, data)) {
+        return false;
+    }
+
+    MetricsCacheReader reader(data);
+    if (reader.read<uint32_t>() != METRICS_CACHE_MAGIC
+        || reader.read<uint32_t>() != METRICS_CACHE_VERSION
+        || reader.read<uint64_t>() != key
+        || reader.read<uint32_t>() != m_symbols.size()) {
+        return false;
+    }
+
+    std::vector<Sym> symbols(m_symbols.size());
+    for (Sym& sym : symbols) {
+        sym.code = reader.read<char32_t>();
+        sym.bbox = reader.readRect();
+        sym.advance = reader.read<double>();
+
+        uint8_t anchorCount = reader.read<uint8_t>();
+        for (uint8_t i = 0; i < anchorCount; ++i) {
+            SmuflAnchorId anchorId = static_cast<SmuflAnchorId>(reader.read<uint8_t>());
+            double x = reader.read<double>();
+            double y = reader.read<double>();
+            sym.smuflAnchors[anchorId] = PointF(x, y);
+        }
+
+        uint8_t subSymbolCount = reader.read<uint8_t>();
+        for (uint8_t i = 0; i < subSymbolCount; ++i) {
+            sym.subSymbolIds.push_back(static_cast<SymId>(reader.read<uint32_t>()));
+        }
+
+        uint8_t cutoutRectCount = reader.read<uint8_t>();
+        if (cutoutRectCount > 0) {
+            std::vector<RectF> rects;
+            for (uint8_t i = 0; i < cutoutRectCount; ++i) {
+                rects.push_back(reader.readRect());
+            }
+            sym.shapeWithCutouts = Shape(rects);
+        }
+
+        if (!reader.ok()) {
+            break;
+        }
+    }
+
+    double textEnclosureThickness = reader.read<double>();
+
+    std::unordered_map<Sid, PropertyValue> engravingDefaults;
+    uint32_t defaultsCount = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < defaultsCount && reader.ok(); ++i) {
+        Sid sid = static_cast<Sid>(reader.read<int32_t>());
+        switch (static_cast<CachedValueType>(reader.read<uint8_t>())) {
+        case CachedValueType::Real:
+            engravingDefaults.insert({ sid, reader.read<double>() });
+            break;
+        case CachedValueType::Bool:
+            engravingDefaults.insert({ sid, reader.read<uint8_t>() != 0 });
+            break;
+        case CachedValueType::String:
+            engravingDefaults.insert({ sid, reader.readString() });
+            break;
+        }
+    }
+
+    if (!reader.ok()) {
+        LOGW() << "invalid font metrics cache: " << cachePath;
+        return false;
+    }
+
+    m_symbols = std::move(symbols);
+    m_textEnclosureThickness = textEnclosureThickness;
+    m_engravingDefaults = std::move(engravingDefaults);
+
+    return true;
+}
+
+void EngravingFont::writeMetricsCache(const path_t& cachePath, uint64_t key)
+{
+    TRACEFUNC;
+
+    ByteArray data;
+    MetricsCacheWriter writer(&data);
+
+    writer.write(METRICS_CACHE_MAGIC);
+    writer.write(METRICS_CACHE_VERSION);
+    writer.write(key);
+    writer.write(static_cast<uint32_t>(m_symbols.size()));
+
+    for (size_t id = 0; id < m_symbols.size(); ++id) {
+        Sym& sym = m_symbols[id];
+        writer.write(sym.code);
+        writer.write(sym.bbox);
+        writer.write(sym.advance);
+
+        writer.write(static_cast<uint8_t>(sym.smuflAnchors.size()));
+        for (const auto& anchor : sym.smuflAnchors) {
+            writer.write(static_cast<uint8_t>(anchor.first));
+            writer.write(anchor.second.x());
+            writer.write(anchor.second.y());
+        }
+
+        writer.write(static_cast<uint8_t>(sym.subSymbolIds.size()));
+        for (SymId subId : sym.subSymbolIds) {
+            writer.write(static_cast<uint32_t>(subId));
+        }
+
+        // precompute the shapes of symbols with cutouts, the others are just the bbox
+        bool hasCutouts = sym.isValid() && !sym.smuflAnchors.empty();
+        if (hasCutouts && sym.shapeWithCutouts.empty()) {
+            constructShapeWithCutouts(sym.shapeWithCutouts, static_cast<SymId>(id));
+        }
+
+        const std::vector<ShapeElement>& cutoutRects = hasCutouts ? sym.shapeWithCutouts.elements() : std::vector<ShapeElement>();
+        writer.write(static_cast<uint8_t>(cutoutRects.size()));
+        for (const ShapeElement& rect : cutoutRects) {
+            writer.write(static_cast<const RectF&>(rect));
+        }
+    }
+
+    writer.write(m_textEnclosureThickness);
+
+    writer.write(static_cast<uint32_t>(m_engravingDefaults.size()));
+    for (const auto& pair : m_engravingDefaults) {
+        writer.write(static_cast<int32_t>(pair.first));
+        switch (pair.second.type()) {
+        case P_TYPE::BOOL:
+            writer.write(CachedValueType::Bool);
+            writer.write(static_cast<uint8_t>(pair.second.toBool()));
+            break;
+        case P_TYPE::STRING:
+            writer.write(CachedValueType::String);
+            writer.write(pair.second.value<String>());
+            break;
+        default:
+            writer.write(CachedValueType::Real);
+            writer.write(pair.second.toReal());
+            break;
+        }
+    }
+
+    if (!fileSystem()) {
+        return;
+    }
+
+    fileSystem()->makePath(io::dirpath(cachePath));
+
+    //! NOTE Several processes may load the same font, so write a temporary file of our own first
+    //! and move it into place. The name is random, the addresses of two processes may be the same
+    std::random_device device;
+    const uint64_t tempId = (static_cast<uint64_t>(device()) << 32) | device();
+    path_t tempPath = cachePath + "." + std::to_string(tempId) + ".tmp";
+    if (!File::writeFile(tempPath, data)) {
+        LOGW() << "failed to write font metrics cache: " << cachePath;
+        return;
+    }
+
+    if (!fileSystem()->move(tempPath, cachePath, true /*replace*/)) {
+        File::remove(tempPath);
+    }
+}
+
 // =============================================
 // Symbol properties
 // =============================================
@@ -28,7 +28,9 @@
 #include "draw/ifontprovider.h"
 #include "draw/types/geometry.h"
 #include "iengravingfontsprovider.h"
+#include "iengravingconfiguration.h"
 
+#include "io/ifilesystem.h"
 #include "io/path.h"
 
 #include "infrastructure/smufl.h"
@@ -52,6 +54,8 @@ class EngravingFont : public IEngravingFont
 {
     muse::GlobalInject<muse::draw::IFontProvider> fontProvider;
     muse::GlobalInject<IEngravingFontsProvider> engravingFonts;
+    muse::GlobalInject<IEngravingConfiguration> configuration;
+    muse::GlobalInject<muse::io::IFileSystem> fileSystem;
 public:
     EngravingFont(const std::string& name, const std::string& family, const muse::io::path_t& filePath,
                   const muse::io::path_t& metadataPath);
@@ -93,6 +97,7 @@ public:
     void draw(const SymIdList& ids, muse::draw::Painter* p, const SizeF& mag, const PointF& pos, const double angle = 0) const override;
 
     void ensureLoad();
+    bool isLoadedFromMetricsCache() const { return m_loadedFromMetricsCache; }
 
 private:
 
@@ -126,12 +131,18 @@ private:
 
     void constructShapeWithCutouts(Shape& shape, SymId id);
 
+    muse::io::path_t metricsCachePath() const;
+    uint64_t metricsCacheKey() const;
+    bool readMetricsCache(const muse::io::path_t& cachePath, uint64_t key);
+    void writeMetricsCache(const muse::io::path_t& cachePath, uint64_t key);
+
     Sym& sym(SymId id);
     const Sym& sym(SymId id) const;
 
     bool useFallbackFont(SymId id) const;
 
     bool m_loaded = false;
+    bool m_loadedFromMetricsCache = false;
     std::vector<Sym> m_symbols;
     mutable muse::draw::Font m_font;
 
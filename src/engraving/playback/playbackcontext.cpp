@@ -306,6 +306,68 @@ DynamicLevelLayers PlaybackContext::dynamicLevelLayers(const Score* score) const
     return result;
 }
 
+void PlaybackContext::updateDynamicLevelLayers(const Score* score, DynamicLevelLayers& layers)
+{
+    auto sameDynamic = [](const auto& pair1, const auto& pair2) {
+        return pair1.first == pair2.first && pair1.second.level == pair2.second.level;
+    };
+
+    for (const auto& dynamics : m_dynamicsByTrack) {
+        const layer_idx_t layerIdx = static_cast<layer_idx_t>(dynamics.first);
+
+        auto layerIt = layers.find(layerIdx);
+        auto previousIt = m_previousDynamicsByTrack.find(dynamics.first);
+
+        if (layerIt == layers.end() || previousIt == m_previousDynamicsByTrack.end()) {
+            DynamicLevelMap dynamicLevelMap;
+            for (const auto& dynamic : dynamics.second) {
+                dynamicLevelMap.emplace(timestampFromTicks(score, dynamic.first), dynamic.second.level);
+            }
+
+            layers.insert_or_assign(layerIdx, std::move(dynamicLevelMap));
+            continue;
+        }
+
+        const DynamicMap& previous = previousIt->second;
+        const DynamicMap& current = dynamics.second;
+        DynamicLevelMap& dynamicLevelMap = layerIt->second;
+
+        // skip the unchanged dynamics at the beginning and at the end
+        auto previousFrom = previous.begin();
+        auto currentFrom = current.begin();
+        while (previousFrom != previous.end() && currentFrom != current.end() && sameDynamic(*previousFrom, *currentFrom)) {
+            ++previousFrom;
+            ++currentFrom;
+        }
+
+        auto previousTo = previous.end();
+        auto currentTo = current.end();
+        while (previousTo != previousFrom && currentTo != currentFrom
+               && sameDynamic(*std::prev(previousTo), *std::prev(currentTo))) {
+            --previousTo;
+            --currentTo;
+        }
+
+        for (auto it = previousFrom; it != previousTo; ++it) {
+            dynamicLevelMap.erase(timestampFromTicks(score, it->first));
+        }
+
+        for (auto it = currentFrom; it != currentTo; ++it) {
+            dynamicLevelMap.insert_or_assign(timestampFromTicks(score, it->first), it->second.level);
+        }
+    }
+
+    for (auto it = layers.begin(); it != layers.end();) {
+        if (muse::contains(m_dynamicsByTrack, static_cast<track_idx_t>(it->first))) {
+            ++it;
+        } else {
+            it = layers.erase(it);
+        }
+    }
+
+    m_previousDynamicsByTrack.clear();
+}
+
 void PlaybackContext::update(const ID partId, const Score* score, bool expandRepeats)
 {
     const Part* part = score->partById(partId);
@@ -352,6 +414,7 @@ void PlaybackContext::clear()
     m_partEndTrack = 0;
     m_usedVoices.clear();
     m_dynamicsByTrack.clear();
+    m_previousDynamicsByTrack.clear();
     m_playTechniquesMap.clear();
     m_soundPresetsByTrack.clear();
     m_textArticulationsByTrack.clear();
@@ -360,11 +423,23 @@ void PlaybackContext::clear()
     m_multiVerseLyricsPositionMap.clear();
 }
 
+void PlaybackContext::clearKeepingDynamics()
+{
+    DynamicsByTrack dynamics = std::move(m_dynamicsByTrack);
+    clear();
+    m_previousDynamicsByTrack = std::move(dynamics);
+}
+
 bool PlaybackContext::hasSoundFlags() const
 {
     return !m_soundPresetsByTrack.empty() || !m_textArticulationsByTrack.empty();
 }
 
+bool PlaybackContext::isVoiceUsed(const voice_idx_t voiceIdx) const
+{
+    return muse::contains(m_usedVoices, voiceIdx);
+}
+
 dynamic_level_t PlaybackContext::nominalDynamicLevel(const track_idx_t trackIdx, const int positionTick) const
 {
     auto dynamicsIt = m_dynamicsByTrack.find(trackIdx);
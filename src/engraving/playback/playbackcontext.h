@@ -60,10 +60,16 @@ public:
 
     muse::mpe::DynamicLevelLayers dynamicLevelLayers(const Score* score) const;
 
+    //! NOTE: Patches the layers built from the dynamics remembered by clearKeepingDynamics()
+    //! Only the dynamics that differ are converted, so the tempo map must not have changed in between
+    void updateDynamicLevelLayers(const Score* score, muse::mpe::DynamicLevelLayers& layers);
+
     void update(const ID partId, const Score* score, bool expandRepeats = true);
     void clear();
+    void clearKeepingDynamics();
 
     bool hasSoundFlags() const;
+    bool isVoiceUsed(const voice_idx_t voiceIdx) const;
 
 private:
     struct DynamicInfo {
@@ -112,6 +118,7 @@ private:
 
     std::set<voice_idx_t> m_usedVoices;
     DynamicsByTrack m_dynamicsByTrack;
+    DynamicsByTrack m_previousDynamicsByTrack;
     SoundPresetsByTrack m_soundPresetsByTrack;
     TextArticulationsByTrack m_textArticulationsByTrack;
     SyllablesByTrack m_syllablesByTrack;
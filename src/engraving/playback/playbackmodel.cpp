@@ -22,6 +22,7 @@
 
 #include "playbackmodel.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "dom/fret.h"
@@ -82,14 +83,15 @@ void PlaybackModel::load(Score* score)
 
         const TickBoundaries tickRange = tickBoundaries(changes);
         const TrackBoundaries trackRange = trackBoundaries(changes);
+        const ContextUpdate ctxUpdate = contextUpdate(changes);
         ChangedTrackIdSet trackChanges;
 
         clearExpiredTracks();
-        clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
+        clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo, ctxUpdate);
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
 
         const InstrumentTrackIdSet oldTracks = existingTrackIdSet();
-        update(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
+        update(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges, ctxUpdate);
 
         notifyAboutChanges(oldTracks, trackChanges);
     });
@@ -397,10 +399,10 @@ muse::async::Channel<InstrumentTrackId> PlaybackModel::trackRemoved() const
 }
 
 void PlaybackModel::update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
-                           ChangedTrackIdSet* trackChanges)
+                           ChangedTrackIdSet* trackChanges, ContextUpdate contextUpdate)
 {
     updateSetupData();
-    updateContext(trackFrom, trackTo);
+    updateContext(trackFrom, trackTo, contextUpdate);
     updateEvents(tickFrom, tickTo, trackFrom, trackTo, trackChanges);
 }
 
@@ -438,7 +440,7 @@ void PlaybackModel::updateSetupData()
     metronomeSetupData.scoreId = scoreId;
 }
 
-void PlaybackModel::updateContext(const track_idx_t trackFrom, const track_idx_t trackTo)
+void PlaybackModel::updateContext(const track_idx_t trackFrom, const track_idx_t trackTo, ContextUpdate contextUpdate)
 {
     for (const Part* part : m_score->parts()) {
         if (trackTo < part->startTrack() || trackFrom >= part->endTrack()) {
@@ -446,22 +448,36 @@ void PlaybackModel::updateContext(const track_idx_t trackFrom, const track_idx_t
         }
 
         for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
-            updateContext(trackId);
+            updateContext(trackId, contextUpdate);
         }
 
         if (part->hasChordSymbol()) {
-            updateContext(chordSymbolsTrackId(part->id()));
+            updateContext(chordSymbolsTrackId(part->id()), contextUpdate);
         }
     }
 }
 
-void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
+void PlaybackModel::updateContext(const InstrumentTrackId& trackId, ContextUpdate contextUpdate)
 {
-    PlaybackContextPtr ctx = playbackCtx(trackId);
-    ctx->update(trackId.partId, m_score, m_expandRepeats);
+    if (!muse::contains(m_playbackCtxMap, trackId)) {
+        contextUpdate = ContextUpdate::Full;
+    }
 
+    PlaybackContextPtr ctx = playbackCtx(trackId);
     PlaybackData& trackData = m_playbackDataMap[trackId];
-    trackData.dynamics = ctx->dynamicLevelLayers(m_score);
+
+    switch (contextUpdate) {
+    case ContextUpdate::Full:
+        ctx->update(trackId.partId, m_score, m_expandRepeats);
+        trackData.dynamics = ctx->dynamicLevelLayers(m_score);
+        break;
+    case ContextUpdate::Incremental:
+        ctx->update(trackId.partId, m_score, m_expandRepeats);
+        ctx->updateDynamicLevelLayers(m_score, trackData.dynamics);
+        break;
+    case ContextUpdate::None:
+        break;
+    }
 
     std::set<timestamp_t> newEventTimestamps;
 
@@ -624,23 +640,12 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
     const ArticulationsProfilePtr metronomeProfile = defaultActiculationProfile(METRONOME_TRACK_ID);
     PlaybackEventsMap& metronomeEvents = m_playbackDataMap[METRONOME_TRACK_ID].originEvents;
 
-    for (const RepeatSegment* repeatSegment : repeatList()) {
+    for (const PlaybackWindow& window : playbackWindows(tickFrom, tickTo)) {
+        const RepeatSegment* repeatSegment = window.repeatSegment;
         int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
-        int repeatStartTick = repeatSegment->tick;
-        int repeatEndTick = repeatSegment->endTick();
-
-        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
-            continue;
-        }
-
-        for (const Measure* measure : repeatSegment->measureList()) {
-            int measureStartTick = measure->tick().ticks();
-            int measureEndTick = measure->endTick().ticks();
-
-            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
-                continue;
-            }
 
+        for (size_t measureIdx = window.measureFrom; measureIdx < window.measureTo; ++measureIdx) {
+            const Measure* measure = repeatSegment->measureList().at(measureIdx);
             int chordRestSegmentNum = -1;
 
             for (const Segment* segment = measure->first(); segment; segment = segment->next()) {
@@ -784,6 +789,115 @@ bool PlaybackModel::hasToReloadScore(const ScoreChanges& changes) const
     return false;
 }
 
+PlaybackModel::ContextUpdate PlaybackModel::contextUpdate(const ScoreChanges& changes) const
+{
+    if (!configuration()->incrementalPlaybackUpdate()) {
+        return ContextUpdate::Full;
+    }
+
+    //! NOTE: the tempo map or the repeats may have changed, so the existing timestamps can't be reused
+    if (hasToReloadScore(changes) || !changes.isValidBoundary()) {
+        return ContextUpdate::Full;
+    }
+
+    //! NOTE: elements which never contribute to the dynamics, play techniques, sound flags or syllables of a context
+    static const std::unordered_set<ElementType> CONTEXT_INDEPENDENT_TYPES {
+        ElementType::NOTE,
+        ElementType::CHORD,
+        ElementType::REST,
+        ElementType::ACCIDENTAL,
+        ElementType::NOTEDOT,
+        ElementType::STEM,
+        ElementType::HOOK,
+        ElementType::BEAM,
+        ElementType::LEDGER_LINE,
+        ElementType::TIE,
+        ElementType::TIE_SEGMENT,
+        ElementType::LAISSEZ_VIB,
+        ElementType::LAISSEZ_VIB_SEGMENT,
+        ElementType::PARTIAL_TIE,
+        ElementType::PARTIAL_TIE_SEGMENT,
+        ElementType::ARTICULATION,
+        ElementType::ORNAMENT,
+        ElementType::TAPPING,
+        ElementType::CHORDLINE,
+        ElementType::ARPEGGIO,
+        ElementType::FINGERING,
+        ElementType::GLISSANDO,
+        ElementType::GLISSANDO_SEGMENT,
+        ElementType::SLUR,
+        ElementType::SLUR_SEGMENT,
+        ElementType::TREMOLO_SINGLECHORD,
+        ElementType::TREMOLO_TWOCHORD,
+        ElementType::TRILL,
+        ElementType::TRILL_SEGMENT,
+        ElementType::VIBRATO,
+        ElementType::VIBRATO_SEGMENT,
+        ElementType::PEDAL,
+        ElementType::PEDAL_SEGMENT,
+        ElementType::LET_RING,
+        ElementType::LET_RING_SEGMENT,
+    };
+
+    //! NOTE: elements which only change the context at their own ticks
+    static const std::unordered_set<ElementType> CONTEXT_TYPES {
+        ElementType::DYNAMIC,
+        ElementType::HAIRPIN,
+        ElementType::HAIRPIN_SEGMENT,
+        ElementType::PLAYTECH_ANNOTATION,
+        ElementType::STAFF_TEXT,
+        ElementType::SOUND_FLAG,
+        ElementType::LYRICS,
+        ElementType::STICKING,
+    };
+
+    if (changes.changedTypes.empty() || !changes.changedStyleIdSet.empty()) {
+        return ContextUpdate::Full;
+    }
+
+    bool contextChanged = false;
+
+    for (const ElementType type : changes.changedTypes) {
+        if (muse::contains(CONTEXT_TYPES, type)) {
+            contextChanged = true;
+        } else if (!muse::contains(CONTEXT_INDEPENDENT_TYPES, type)) {
+            return ContextUpdate::Full; // e.g. inserted measures move the following tempo changes
+        }
+    }
+
+    if (contextChanged) {
+        return ContextUpdate::Incremental;
+    }
+
+    //! NOTE: the contexts only keep the sound flags, text articulations and syllables of the voices in use
+    for (const auto& pair : changes.changedObjects) {
+        if (!pair.first->isEngravingItem()) {
+            continue;
+        }
+
+        const EngravingItem* item = toEngravingItem(pair.first);
+        if (!item->isChordRest() && !item->isNote()) {
+            continue;
+        }
+
+        const voice_idx_t voiceIdx = item->voice();
+        if (voiceIdx == 0) {
+            continue; // always in use
+        }
+
+        if (muse::contains(pair.second, CommandType::RemoveElement)) {
+            return ContextUpdate::Incremental;
+        }
+
+        auto ctxIt = m_playbackCtxMap.find(idKey(item));
+        if (ctxIt == m_playbackCtxMap.cend() || !ctxIt->second->isVoiceUsed(voiceIdx)) {
+            return ContextUpdate::Incremental;
+        }
+    }
+
+    return ContextUpdate::None;
+}
+
 void PlaybackModel::clearExpiredTracks()
 {
     auto needRemoveTrack = [this](const InstrumentTrackId& trackId) {
@@ -818,22 +932,32 @@ void PlaybackModel::clearExpiredTracks()
     }
 }
 
-void PlaybackModel::clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo)
+void PlaybackModel::clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo, ContextUpdate contextUpdate)
 {
+    if (contextUpdate == ContextUpdate::None) {
+        return;
+    }
+
+    auto clearContext = [this, contextUpdate](const InstrumentTrackId& trackId) {
+        PlaybackContextPtr ctx = playbackCtx(trackId);
+        if (contextUpdate == ContextUpdate::Incremental) {
+            ctx->clearKeepingDynamics();
+        } else {
+            ctx->clear();
+        }
+    };
+
     for (const Part* part : m_score->parts()) {
         if (part->startTrack() > trackTo || part->endTrack() <= trackFrom) {
             continue;
         }
 
         for (const InstrumentTrackId& trackId : part->instrumentTrackIdSet()) {
-            PlaybackContextPtr ctx = playbackCtx(trackId);
-            ctx->clear();
+            clearContext(trackId);
         }
 
         if (part->hasChordSymbol()) {
-            InstrumentTrackId trackId = chordSymbolsTrackId(part->id());
-            PlaybackContextPtr ctx = playbackCtx(trackId);
-            ctx->clear();
+            clearContext(chordSymbolsTrackId(part->id()));
         }
     }
 }
@@ -875,22 +999,12 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
         return;
     }
 
-    for (const RepeatSegment* repeatSegment : repeatList()) {
+    for (const PlaybackWindow& window : playbackWindows(tickFrom, tickTo)) {
+        const RepeatSegment* repeatSegment = window.repeatSegment;
         const int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
-        const int repeatStartTick = repeatSegment->tick;
-        const int repeatEndTick = repeatSegment->endTick();
 
-        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
-            continue;
-        }
-
-        int removeEventsFromTick = std::max(tickFrom, repeatStartTick);
-        timestamp_t removeEventsFrom = timestampFromTicks(m_score, removeEventsFromTick + tickPositionOffset);
-
-        //! NOTE: the end tick of the current repeat segment == the start tick of the next repeat segment
-        //! so subtract 1 to avoid removing events belonging to the next segment
-        int removeEventsToTick = std::min(tickTo, repeatEndTick - 1);
-        timestamp_t removeEventsTo = timestampFromTicks(m_score, removeEventsToTick + tickPositionOffset);
+        timestamp_t removeEventsFrom = timestampFromTicks(m_score, window.utickFrom);
+        timestamp_t removeEventsTo = timestampFromTicks(m_score, window.utickTo);
 
         removeEventsFromRange(trackFrom, trackTo, removeEventsFrom, removeEventsTo, trackChanges);
 
@@ -898,14 +1012,11 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
             continue;
         }
 
-        for (const Measure* measure : repeatSegment->measureList()) {
+        for (size_t measureIdx = window.measureFrom; measureIdx < window.measureTo; ++measureIdx) {
+            const Measure* measure = repeatSegment->measureList().at(measureIdx);
             const int measureStartTick = measure->tick().ticks();
             const int measureEndTick = measure->endTick().ticks();
 
-            if (measureStartTick > tickTo || measureEndTick <= tickFrom) {
-                continue;
-            }
-
             removeEventsFrom = timestampFromTicks(m_score, measureStartTick + tickPositionOffset);
             removeEventsTo = timestampFromTicks(m_score, measureEndTick + tickPositionOffset - 1);
 
@@ -1121,6 +1232,46 @@ PlaybackModel::TickBoundaries PlaybackModel::tickBoundaries(const ScoreChanges&
     return result;
 }
 
+PlaybackModel::PlaybackWindows PlaybackModel::playbackWindows(const int tickFrom, const int tickTo) const
+{
+    PlaybackWindows result;
+
+    for (const RepeatSegment* repeatSegment : repeatList()) {
+        const int repeatStartTick = repeatSegment->tick;
+        const int repeatEndTick = repeatSegment->endTick();
+
+        if (repeatStartTick > tickTo || repeatEndTick <= tickFrom) {
+            continue;
+        }
+
+        //! NOTE: the measures of a repeat segment are ordered by tick,
+        //! so there is no need to check each of them
+        const std::vector<const Measure*>& measures = repeatSegment->measureList();
+        auto measureFrom = std::partition_point(measures.cbegin(), measures.cend(), [tickFrom](const Measure* measure) {
+            return measure->endTick().ticks() <= tickFrom;
+        });
+        auto measureTo = std::partition_point(measureFrom, measures.cend(), [tickTo](const Measure* measure) {
+            return measure->tick().ticks() <= tickTo;
+        });
+
+        const int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
+
+        PlaybackWindow window;
+        window.repeatSegment = repeatSegment;
+        window.measureFrom = static_cast<size_t>(std::distance(measures.cbegin(), measureFrom));
+        window.measureTo = static_cast<size_t>(std::distance(measures.cbegin(), measureTo));
+        window.utickFrom = std::max(tickFrom, repeatStartTick) + tickPositionOffset;
+
+        //! NOTE: the end tick of the current repeat segment == the start tick of the next repeat segment
+        //! so subtract 1 to avoid touching events belonging to the next segment
+        window.utickTo = std::min(tickTo, repeatEndTick - 1) + tickPositionOffset;
+
+        result.push_back(window);
+    }
+
+    return result;
+}
+
 const RepeatList& PlaybackModel::repeatList() const
 {
     m_score->masterScore()->setExpandRepeats(m_expandRepeats);
@@ -25,6 +25,7 @@
 #include <unordered_map>
 #include <map>
 #include <functional>
+#include <vector>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
@@ -35,6 +36,7 @@
 #include "mpe/iarticulationprofilesrepository.h"
 
 #include "../types/types.h"
+#include "../iengravingconfiguration.h"
 #include "playbackeventsrenderer.h"
 #include "playbacksetupdataresolver.h"
 #include "playbackcontext.h"
@@ -46,11 +48,13 @@ class EngravingItem;
 class Segment;
 class Instrument;
 class RepeatList;
+class RepeatSegment;
 
 class PlaybackModel : public muse::Contextable, public muse::async::Asyncable
 {
 public:
     muse::GlobalInject<muse::mpe::IArticulationProfilesRepository> profilesRepository;
+    muse::GlobalInject<IEngravingConfiguration> configuration;
 
 public:
     PlaybackModel(const muse::modularity::ContextPtr& iocCtx)
@@ -111,15 +115,34 @@ private:
         track_idx_t trackTo = muse::nidx;
     };
 
+    //! NOTE: The measures of a repeat segment touched by a changed tick range,
+    //! and the repeat-unrolled ticks whose events have to be rendered again
+    struct PlaybackWindow
+    {
+        const RepeatSegment* repeatSegment = nullptr;
+        size_t measureFrom = 0;
+        size_t measureTo = 0; // exclusive
+        int utickFrom = -1;
+        int utickTo = -1; // inclusive
+    };
+
+    using PlaybackWindows = std::vector<PlaybackWindow>;
+
+    enum class ContextUpdate {
+        Full,           // rebuild the contexts and their dynamics
+        Incremental,    // rebuild the contexts, patch only the dynamics that differ
+        None            // the contexts are unaffected, only restore their events
+    };
+
     InstrumentTrackId idKey(const EngravingItem* item) const;
     InstrumentTrackId idKey(const std::vector<const EngravingItem*>& items) const;
     InstrumentTrackId idKey(const ID& partId, const String& instrumentId) const;
 
     void update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
-                ChangedTrackIdSet* trackChanges = nullptr);
+                ChangedTrackIdSet* trackChanges = nullptr, ContextUpdate contextUpdate = ContextUpdate::Full);
     void updateSetupData();
-    void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo);
-    void updateContext(const InstrumentTrackId& trackId);
+    void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo, ContextUpdate contextUpdate = ContextUpdate::Full);
+    void updateContext(const InstrumentTrackId& trackId, ContextUpdate contextUpdate = ContextUpdate::Full);
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
 
@@ -132,9 +155,10 @@ private:
 
     bool hasToReloadTracks(const ScoreChanges& changes) const;
     bool hasToReloadScore(const ScoreChanges& changes) const;
+    ContextUpdate contextUpdate(const ScoreChanges& changes) const;
 
     void clearExpiredTracks();
-    void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo);
+    void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo, ContextUpdate contextUpdate = ContextUpdate::Full);
     void clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                             ChangedTrackIdSet* trackChanges = nullptr);
     void collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result);
@@ -151,6 +175,7 @@ private:
 
     TrackBoundaries trackBoundaries(const ScoreChanges& changes) const;
     TickBoundaries tickBoundaries(const ScoreChanges& changes) const;
+    PlaybackWindows playbackWindows(const int tickFrom, const int tickTo) const;
 
     const RepeatList& repeatList() const;
 
@@ -66,6 +66,11 @@ void EngravingUndoStackModel::reload()
 
         for (size_t i = 1; i <= undoStack->size(); ++i) {
             const UndoCommand* cmd = undoStack->lastAtIndex(i);
+            if (!cmd) {
+                // dropped to respect the memory budget
+                continue;
+            }
+
             Item* item = createItem(m_rootItem, cmd, cmd == undoStack->last());
             load(cmd, item);
         }
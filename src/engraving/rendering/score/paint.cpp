@@ -145,8 +145,8 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Sco
                 disableClipping = true;
             }
 
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintItems(*painter, elements, opt);
+            std::vector<EngravingItem*> elements = pageItemsInDrawingOrder(page, drawRect.translated(-pagePos));
+            paintSortedItems(*painter, elements, opt);
 
             if (disableClipping) {
                 painter->setClipping(false);
@@ -238,7 +238,13 @@ void Paint::paintItems(Painter& painter, const std::vector<EngravingItem*>& item
 
     std::sort(sortedItems.begin(), sortedItems.end(), mu::engraving::elementLessThan);
 
-    for (const EngravingItem* item : sortedItems) {
+    paintSortedItems(painter, sortedItems, opt);
+}
+
+void Paint::paintSortedItems(Painter& painter, const std::vector<EngravingItem*>& items, const PaintOptions& opt)
+{
+    TRACEFUNC;
+    for (const EngravingItem* item : items) {
         if (!item->isInteractionAvailable()) {
             continue;
         }
@@ -246,3 +252,54 @@ void Paint::paintItems(Painter& painter, const std::vector<EngravingItem*>& item
         paintItem(painter, item, opt);
     }
 }
+
+//---------------------------------------------------------
+//   pageItemsInDrawingOrder
+//    Takes the items intersecting rect from the page display
+//    list, which is already ordered by z and track. Only the
+//    runs of equal z which contain selected or invisible items
+//    need to be reordered to match elementLessThan.
+//---------------------------------------------------------
+
+std::vector<EngravingItem*> Paint::pageItemsInDrawingOrder(Page* page, const RectF& rect)
+{
+    TRACEFUNC;
+
+    std::vector<EngravingItem*> items;
+
+    auto drawingClass = [](const EngravingItem* item) {
+        return (item->selected() ? 2 : 0) + (item->visible() ? 1 : 0);
+    };
+
+    size_t runStart = 0;
+    bool runNeedsReorder = false;
+    int runZ = 0;
+
+    auto finishRun = [&]() {
+        if (runNeedsReorder) {
+            std::stable_sort(items.begin() + runStart, items.end(), [&](const EngravingItem* i1, const EngravingItem* i2) {
+                return drawingClass(i1) < drawingClass(i2);
+            });
+        }
+        runStart = items.size();
+        runNeedsReorder = false;
+    };
+
+    for (const Page::DisplayItem& di : page->displayList()) {
+        if (!di.rect.intersects(rect)) {
+            continue;
+        }
+
+        if (di.z != runZ) {
+            finishRun();
+            runZ = di.z;
+        }
+
+        runNeedsReorder = runNeedsReorder || di.item->selected() || !di.item->visible();
+        items.push_back(di.item);
+    }
+
+    finishRun();
+
+    return items;
+}
@@ -40,8 +40,11 @@ public:
     static void paintScore(muse::draw::Painter* painter, Score* score, const IScoreRenderer::ScorePaintOptions& opt);
     static void paintItem(muse::draw::Painter& painter, const EngravingItem* item, const PaintOptions& opt);
     static void paintItems(muse::draw::Painter& painter, const std::vector<EngravingItem*>& items, const PaintOptions& opt);
+    static void paintSortedItems(muse::draw::Painter& painter, const std::vector<EngravingItem*>& items, const PaintOptions& opt);
 
     static SizeF pageSizeInch(const Score* score);
     static SizeF pageSizeInch(const Score* score, const IScoreRenderer::ScorePaintOptions& opt);
+
+    static std::vector<EngravingItem*> pageItemsInDrawingOrder(Page* page, const RectF& rect);
 };
 }
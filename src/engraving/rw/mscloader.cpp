@@ -23,8 +23,14 @@
 
 #include <memory>
 
+#include "containers.h"
 #include "global/io/buffer.h"
 #include "global/types/retval.h"
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include <future>
+#endif
 
 #include "../engravingerrors.h"
 
@@ -34,6 +40,8 @@
 #include "../dom/audio.h"
 #include "../dom/excerpt.h"
 #include "../dom/imageStore.h"
+#include "../dom/part.h"
+#include "../dom/staff.h"
 
 #include "engraving/automation/iautomation.h"
 
@@ -71,6 +79,131 @@ static RetVal<IReaderPtr> makeReader(int version, bool ignoreVersionError)
     return RetVal<IReaderPtr>::make_ok(RWRegister::reader(version));
 }
 
+//---------------------------------------------------------
+//   readExcerptScore
+//    Reads into the part score already set on the excerpt
+//---------------------------------------------------------
+
+static Ret readExcerptScore(Excerpt* ex, const ByteArray& styleData, const ByteArray& scoreData, const ReadLinks& links,
+                            bool ignoreVersionError)
+{
+    Score* partScore = ex->excerptScore();
+
+    ByteArray excerptStyleData = styleData;
+    auto excerptStyleBuf = Buffer::opened(IODevice::ReadOnly, &excerptStyleData);
+    partScore->style().read(&excerptStyleBuf);
+
+    XmlReader xml(scoreData);
+    xml.setDocName(ex->fileName());
+
+    ReadInOutData partReadInData;
+    partReadInData.links = links;
+
+    RetVal<IReaderPtr> reader = makeReader(ex->masterScore()->mscVersion(), ignoreVersionError);
+    if (!reader.ret) {
+        return reader.ret;
+    }
+
+    return reader.val->readScoreFile(partScore, xml, &partReadInData);
+}
+
+static void initExcerptName(Excerpt* ex, const String& nameFromMeta)
+{
+    if (!ex->name().empty()) {
+        return;
+    }
+
+    // If no excerpt name tag was found while reading, try the "partName" meta tag
+    if (nameFromMeta.empty()) {
+        // If that's also empty, fall back to the filename
+        ex->setName(ex->fileName(), /*saveAndNotify=*/ false);
+    } else {
+        ex->setName(nameFromMeta, /*saveAndNotify=*/ false);
+    }
+}
+
+//---------------------------------------------------------
+//   readExcerptScoreHeader
+//    Reads what is needed to list a part score without
+//    reading its music: the name and the linked parts.
+//    Returns false if the part score should be read now.
+//---------------------------------------------------------
+
+static bool readExcerptScoreHeader(Excerpt* ex, XmlReader& xml, std::vector<Part*>& parts)
+{
+    const EIDRegister* eidRegister = ex->masterScore()->eidRegister();
+    String nameFromMeta;
+
+    while (xml.readNextStartElement()) {
+        const AsciiStringView tag(xml.name());
+        if (tag == "name") {
+            ex->setName(xml.readText(), /*saveAndNotify=*/ false);
+        } else if (tag == "initialPartId") {
+            ex->setInitialPartId(ID(xml.readInt()));
+        } else if (tag == "open") {
+            if (xml.readBool()) {
+                // open part scores are laid out with the file anyway
+                return false;
+            }
+        } else if (tag == "metaTag" && xml.attribute("name") == u"partName") {
+            nameFromMeta = xml.readText();
+        } else if (tag == "Part") {
+            while (xml.readNextStartElement()) {
+                if (xml.name() != "Staff") {
+                    xml.skipCurrentElement();
+                    continue;
+                }
+
+                while (xml.readNextStartElement()) {
+                    if (xml.name() != "linkedTo") {
+                        xml.skipCurrentElement();
+                        continue;
+                    }
+
+                    EngravingObject* linked = eidRegister->itemFromEID(EID::fromStdString(xml.readAsciiText()));
+                    if (linked && linked->isStaff()) {
+                        Part* part = toStaff(linked)->part();
+                        if (!muse::contains(parts, part)) {
+                            parts.push_back(part);
+                        }
+                    }
+                }
+            }
+        } else if (tag == "Staff") {
+            // the music follows the parts
+            break;
+        } else {
+            xml.skipCurrentElement();
+        }
+    }
+
+    initExcerptName(ex, nameFromMeta);
+
+    return !parts.empty() && xml.error() == muse::XmlStreamReader::NoError;
+}
+
+static bool readExcerptHeader(Excerpt* ex, const ByteArray& scoreData, std::vector<Part*>& parts)
+{
+    XmlReader xml(scoreData);
+    xml.setDocName(ex->fileName());
+
+    while (xml.readNextStartElement()) {
+        if (xml.name() != "museScore") {
+            xml.unknown();
+            continue;
+        }
+
+        while (xml.readNextStartElement()) {
+            if (xml.name() == "Score") {
+                return readExcerptScoreHeader(ex, xml, parts);
+            }
+            xml.skipCurrentElement();
+        }
+    }
+
+    return false;
+}
+
 Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, rw::ReadInOutData* inOut,
                         bool ignoreVersionError)
 {
@@ -155,78 +288,200 @@ Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, rw
 
     // Read excerpts
     if (ret && masterScore->mscVersion() >= 400 && mscReader.isContainer()) {
-        std::vector<String> excerptFileNames = mscReader.excerptFileNames();
-        for (const String& excerptFileName : excerptFileNames) {
-            Score* partScore = masterScore->createScore();
+        ret = readExcerpts(masterScore, mscReader, inOut->links, ignoreVersionError);
+    }
 
-            compat::ReadStyleHook::setupDefaultStyle(partScore);
+    // Compatibility conversions
+    // NOTE: must be done after all score and parts have been read
+    compat::CompatUtils::doCompatibilityConversions(masterScore);
+
+    //  Read audio
+    {
+        if (masterScore->audio()) {
+            ByteArray dbuf1 = mscReader.readAudioFile();
+            masterScore->audio()->setData(dbuf1);
+        }
+    }
+
+    // Read automation
+    {
+        if (masterScore->automation()) {
+            ByteArray ba = mscReader.readAutomationJsonFile();
+            masterScore->automation()->read(ba);
+        }
+    }
 
-            Excerpt* ex = new Excerpt(masterScore);
-            ex->setExcerptScore(partScore);
-            ex->setFileName(excerptFileName);
+    return ret;
+}
 
-            ByteArray excerptStyleData = mscReader.readExcerptStyleFile(excerptFileName);
-            auto excerptStyleBuf = Buffer::opened(IODevice::ReadOnly, &excerptStyleData);
-            partScore->style().read(&excerptStyleBuf);
+//---------------------------------------------------------
+//   readExcerpts
+//    Part scores are read concurrently and/or deferred
+//    until they are first accessed when that is enabled.
+//    Both need files that link the part items to the
+//    master score by EID (see TRead::readItemLink) and
+//    that need no compatibility conversions.
+//---------------------------------------------------------
 
-            ByteArray excerptData = mscReader.readExcerptFile(excerptFileName);
+Ret MscLoader::readExcerpts(MasterScore* masterScore, const MscReader& mscReader, const ReadLinks& links, bool ignoreVersionError)
+{
+    TRACEFUNC;
 
-            XmlReader xml(excerptData);
-            xml.setDocName(excerptFileName);
+    struct ExcerptFile {
+        Excerpt* excerpt = nullptr;
+        ByteArray styleData;
+        ByteArray scoreData;
+        bool deferred = false;
+    };
+
+    const bool linkedByEid = masterScore->mscVersion() >= 460;
+    const bool deferExcerpts = linkedByEid && configuration() && configuration()->deferredExcerptsReading();
+
+    // MscReader is not thread-safe, so the files are read first
+    std::vector<ExcerptFile> files;
+    for (const String& excerptFileName : mscReader.excerptFileNames()) {
+        ExcerptFile file;
+        file.excerpt = new Excerpt(masterScore);
+        file.excerpt->setFileName(excerptFileName);
+        file.styleData = mscReader.readExcerptStyleFile(excerptFileName);
+        file.scoreData = mscReader.readExcerptFile(excerptFileName);
+        files.push_back(std::move(file));
+    }
 
-            ReadInOutData partReadInData;
-            partReadInData.links = inOut->links;
+    size_t readCount = 0;
 
-            RetVal<IReaderPtr> reader = makeReader(masterScore->mscVersion(), ignoreVersionError);
-            if (!reader.ret) {
-                ret = reader.ret;
-                break;
+    for (ExcerptFile& file : files) {
+        std::vector<Part*> parts;
+        file.deferred = deferExcerpts && readExcerptHeader(file.excerpt, file.scoreData, parts);
+
+        if (!file.deferred) {
+            Score* partScore = masterScore->createScore();
+            compat::ReadStyleHook::setupDefaultStyle(partScore);
+            file.excerpt->setExcerptScore(partScore);
+            ++readCount;
+            continue;
+        }
+
+        auto deferredScore = std::make_unique<Excerpt::DeferredScore>();
+        deferredScore->styleData = file.styleData;
+        deferredScore->scoreData = file.scoreData;
+        deferredScore->read = [ignoreVersionError](Excerpt* ex, const Excerpt::DeferredScore& data) {
+            readDeferredExcerpt(ex, data.styleData, data.scoreData, ignoreVersionError);
+        };
+
+        file.excerpt->setParts(parts);
+        file.excerpt->setInited(true);
+        file.excerpt->setDeferredScore(std::move(deferredScore));
+    }
+
+    std::vector<Ret> rets(files.size(), muse::make_ok());
+
+    auto readFile = [&files, &rets, &links, ignoreVersionError](size_t idx) {
+        const ExcerptFile& file = files.at(idx);
+        rets[idx] = readExcerptScore(file.excerpt, file.styleData, file.scoreData, links, ignoreVersionError);
+    };
+
+    auto readFiles = [&files, &rets, &readFile]() {
+        for (size_t i = 0; i < files.size(); ++i) {
+            if (files.at(i).deferred) {
+                continue;
             }
 
-            ret = reader.val->readScoreFile(partScore, xml, &partReadInData);
-            if (!ret) {
+            readFile(i);
+            if (!rets.at(i)) {
                 break;
             }
+        }
+    };
+
+#ifdef MUSE_THREADS_SUPPORT
+    const bool parallel = linkedByEid && readCount > 1 && configuration() && configuration()->parallelExcerptsReading();
+    if (parallel) {
+        //! NOTE The part scores are independent, the master score state they modify
+        //! while being read is guarded by MasterScore::partsMutex().
+        //! Fonts are loaded lazily, make sure the workers don't do it
+        if (engravingFonts()) {
+            engravingFonts()->loadAllFonts();
+            engravingFonts()->fallbackFont();
+        }
 
-            partScore->linkMeasures(masterScore);
-
-            if (ex->name().empty()) {
-                // If no excerpt name tag was found while reading, try the "partName" meta tag
-                const String nameFromMeta = partScore->metaTag(u"partName");
+        std::vector<std::future<void> > futures;
+        futures.reserve(readCount);
 
-                if (nameFromMeta.empty()) {
-                    // If that's also empty, fall back to the filename
-                    ex->setName(excerptFileName, /*saveAndNotify=*/ false);
-                } else {
-                    ex->setName(nameFromMeta, /*saveAndNotify=*/ false);
-                }
+        for (size_t i = 0; i < files.size(); ++i) {
+            if (!files.at(i).deferred) {
+                futures.push_back(std::async(std::launch::async, readFile, i));
             }
+        }
 
-            masterScore->addExcerpt(ex);
+        for (auto& future : futures) {
+            future.get();
         }
+    } else {
+        readFiles();
     }
+#else
+    UNUSED(readCount);
+    readFiles();
+#endif
+
+    for (const Ret& ret : rets) {
+        if (!ret) {
+            //! NOTE None of the excerpts is added yet, delete them all with their part scores
+            for (ExcerptFile& file : files) {
+                delete file.excerpt;
+            }
 
-    // Compatibility conversions
-    // NOTE: must be done after all score and parts have been read
-    compat::CompatUtils::doCompatibilityConversions(masterScore);
-
-    //  Read audio
-    {
-        if (masterScore->audio()) {
-            ByteArray dbuf1 = mscReader.readAudioFile();
-            masterScore->audio()->setData(dbuf1);
+            return ret;
         }
     }
 
-    // Read automation
-    {
-        if (masterScore->automation()) {
-            ByteArray ba = mscReader.readAutomationJsonFile();
-            masterScore->automation()->read(ba);
+    for (size_t i = 0; i < files.size(); ++i) {
+        Excerpt* ex = files.at(i).excerpt;
+        if (!files.at(i).deferred) {
+            Score* partScore = ex->excerptScore();
+            partScore->linkMeasures(masterScore);
+            initExcerptName(ex, partScore->metaTag(u"partName"));
         }
+
+        masterScore->addExcerpt(ex);
     }
 
-    return ret;
+    return muse::make_ok();
+}
+
+//---------------------------------------------------------
+//   readDeferredExcerpt
+//    Reads a part score and sets it up like the part scores
+//    read together with the file (see EngravingProject::setupMasterScore)
+//    Only files that link the part items by EID are deferred,
+//    the items are linked through the EIDRegister of the
+//    master score as it is now, so no links from reading the
+//    master score have to be kept.
+//---------------------------------------------------------
+
+void MscLoader::readDeferredExcerpt(Excerpt* ex, const ByteArray& styleData, const ByteArray& scoreData, bool ignoreVersionError)
+{
+    MasterScore* masterScore = ex->masterScore();
+
+    Score* partScore = masterScore->createScore();
+    compat::ReadStyleHook::setupDefaultStyle(partScore);
+    ex->setExcerptScore(partScore);
+
+    Ret ret = readExcerptScore(ex, styleData, scoreData, ReadLinks(), ignoreVersionError);
+    if (!ret) {
+        LOGE() << "failed to read part score " << ex->fileName() << ": " << ret.toString();
+    }
+
+    partScore->linkMeasures(masterScore);
+
+    ex->parts().clear();
+    masterScore->initParts(ex);
+    ex->setInited(false);
+
+    partScore->setPlaylistDirty();
+    partScore->createPaddingTable();
+    partScore->doLayout();
 }
 
 Ret MscLoader::readMasterScore(MasterScore* score, XmlReader& e, bool ignoreVersionError, ReadInOutData* out,
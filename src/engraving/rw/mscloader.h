@@ -23,7 +23,10 @@
 #pragma once
 
 #include "global/types/ret.h"
+#include "global/modularity/ioc.h"
 
+#include "../iengravingconfiguration.h"
+#include "../iengravingfontsprovider.h"
 #include "../infrastructure/mscreader.h"
 
 namespace mu::engraving::compat {
@@ -32,13 +35,18 @@ class ReadStyleHook;
 
 namespace mu::engraving::rw {
 struct ReadInOutData;
+struct ReadLinks;
 }
 
 namespace mu::engraving {
+class Excerpt;
 class MasterScore;
 class XmlReader;
 class MscLoader
 {
+    muse::GlobalInject<IEngravingConfiguration> configuration;
+    muse::GlobalInject<IEngravingFontsProvider> engravingFonts;
+
 public:
     MscLoader() = default;
 
@@ -48,5 +56,9 @@ private:
     friend class MasterScore;
     muse::Ret readMasterScore(MasterScore* score, XmlReader&, bool ignoreVersionError, rw::ReadInOutData* out = nullptr,
                               compat::ReadStyleHook* styleHook = nullptr);
+
+    muse::Ret readExcerpts(MasterScore* score, const MscReader& mscReader, const rw::ReadLinks& links, bool ignoreVersionError);
+    static void readDeferredExcerpt(Excerpt* excerpt, const muse::ByteArray& styleData, const muse::ByteArray& scoreData,
+                                    bool ignoreVersionError);
 };
 }
@@ -93,6 +93,18 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool createTh
             };
 
             auto serializeExcerpt = [masterWriteOutData, score](Excerpt* excerpt, size_t excerptIndex) -> ExcerptData {
+                //! NOTE A deferred part score hasn't been read since the file was opened,
+                //! so it is unchanged and is written back as it was read
+                if (const Excerpt::DeferredScore* deferredScore = excerpt->deferredScore()) {
+                    excerpt->updateFileName(excerptIndex);
+
+                    ExcerptData data;
+                    data.fileName = excerpt->fileName();
+                    data.styleData = deferredScore->styleData;
+                    data.scoreData = deferredScore->scoreData;
+                    return data;
+                }
+
                 Score* partScore = excerpt->excerptScore();
                 IF_ASSERT_FAILED(partScore && partScore != score) {
                     return ExcerptData();
@@ -305,8 +305,11 @@ bool Read460::readScoreTag(Score* score, XmlReader& e, ReadContext& ctx)
         p->updateHarmonyChannels(false);
     }
 
-    score->masterScore()->rebuildMidiMapping();
-    score->masterScore()->updateChannel();
+    {
+        std::lock_guard<std::recursive_mutex> lock(score->masterScore()->partsMutex());
+        score->masterScore()->rebuildMidiMapping();
+        score->masterScore()->updateChannel();
+    }
 
     for (Staff* staff : score->staves()) {
         staff->updateOttava();
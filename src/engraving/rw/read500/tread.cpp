@@ -595,6 +595,10 @@ void TRead::readItemLink(EngravingItem* item, XmlReader& xml, ReadContext& ctx)
     AsciiStringView s = xml.readAsciiText();
     EID eid = EID::fromStdString(s);
     DO_ASSERT(eid.isValid());
+
+    // the main element may be linked by other part scores read at the same time
+    std::lock_guard<std::recursive_mutex> lock(ctx.score()->masterScore()->partsMutex());
+
     EIDRegister* eidRegister = ctx.score()->masterScore()->eidRegister();
     EngravingObject* mainElement = eidRegister->itemFromEID(eid);
     IF_ASSERT_FAILED(mainElement) {
@@ -3602,6 +3606,7 @@ bool TRead::readProperties(Part* p, XmlReader& e, ReadContext& ctx)
         EngravingObject* obj = eidRegister->itemFromEID(eid);
         DO_ASSERT(obj && obj->isSharedPart());
         SharedPart* sharedPart = toSharedPart(obj);
+        std::lock_guard<std::recursive_mutex> lock(p->masterScore()->partsMutex());
         sharedPart->addOriginPart(p);
     } else if (tag == "Staff") {
         Staff* staff = Factory::createStaff(p);
@@ -3901,6 +3906,8 @@ void TRead::readNoteParenGroup(Chord* ch, XmlReader& e, ReadContext& ctx)
     }
 
     if (ch->links() && ch->links()->mainElement() != ch) {
+        std::lock_guard<std::recursive_mutex> lock(ch->masterScore()->partsMutex());
+
         Chord* mainChord = toChord(ch->links()->mainElement());
         Note* firstNote = notes.front();
         Note* mainNote = firstNote ? toNote(firstNote->findLinkedInStaff(mainChord->staff())) : nullptr;
@@ -41,6 +41,8 @@ using namespace mu;
 using namespace muse::io;
 using namespace mu::engraving;
 
+const MStyle::PrecomputedValue MStyle::NO_VALUE;
+
 const PropertyValue& MStyle::value(Sid idx) const
 {
     if (idx == Sid::NOSTYLE) {
@@ -62,7 +64,7 @@ double MStyle::valueAbsolute(Sid idx) const
         return 0.0;
     }
 
-    return m_precomputedValues[size_t(idx)];
+    return m_precomputedValues[size_t(idx)].absolute;
 }
 
 void MStyle::set(const Sid t, const PropertyValue& val)
@@ -76,10 +78,7 @@ void MStyle::set(const Sid t, const PropertyValue& val)
     if (t == Sid::spatium) {
         precomputeValues();
     } else {
-        if (StyleDef::styleValues[idx].valueType() == P_TYPE::SPATIUM) {
-            double _spatium = value(Sid::spatium).toReal();
-            m_precomputedValues[idx] = m_values[idx].value<Spatium>().val() * _spatium;
-        }
+        precomputeValue(t, value(Sid::spatium).toReal());
     }
 }
 
@@ -92,9 +91,35 @@ void MStyle::precomputeValues()
 {
     double _spatium = value(Sid::spatium).toReal();
     for (const StyleDef::StyleValue& t : StyleDef::styleValues) {
-        if (t.valueType() == P_TYPE::SPATIUM) {
-            m_precomputedValues[t.idx()] = value(t.sid).value<Spatium>().val() * _spatium;
-        }
+        precomputeValue(t.sid, _spatium);
+    }
+}
+
+void MStyle::precomputeValue(Sid idx, double spatium)
+{
+    const PropertyValue& v = value(idx);
+    PrecomputedValue& p = m_precomputedValues[size_t(idx)];
+    p = PrecomputedValue();
+
+    switch (StyleDef::styleValues[size_t(idx)].valueType()) {
+    case P_TYPE::SPATIUM:
+        p.real = v.value<Spatium>().val();
+        p.absolute = p.real * spatium;
+        break;
+    case P_TYPE::REAL:
+        p.real = v.toReal();
+        break;
+    case P_TYPE::BOOL:
+        p.integer = v.toBool();
+        break;
+    default:
+        break;
+    }
+
+    if (v.type() == P_TYPE::INT || v.type() == P_TYPE::BOOL || v.isEnum()) {
+        p.integer = v.toInt();
+    } else {
+        p.hasInteger = !v.isValid();
     }
 }
 
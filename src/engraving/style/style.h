@@ -44,20 +44,25 @@ class XmlWriter;
 class MStyle
 {
 public:
-    MStyle() = default;
+    MStyle() { precomputeValues(); }
 
     const PropertyValue& styleV(Sid idx) const { return value(idx); }
     Spatium styleS(Sid idx) const
     {
         assert(MStyle::valueType(idx) == P_TYPE::SPATIUM);
-        return value(idx).value<Spatium>();
+        return Spatium(precomputed(idx).real);
     }
 
     double   styleAbsolute(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::SPATIUM); return valueAbsolute(idx); }
     String   styleSt(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::STRING); return value(idx).value<String>(); }
-    bool     styleB(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::BOOL); return value(idx).toBool(); }
-    double   styleD(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::REAL); return value(idx).toReal(); }
-    int      styleI(Sid idx) const { /* can be int or enum, so no assert */ return value(idx).toInt(); }
+    bool     styleB(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::BOOL); return precomputed(idx).integer != 0; }
+    double   styleD(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::REAL); return precomputed(idx).real; }
+    int      styleI(Sid idx) const
+    {
+        /* can be int or enum, so no assert */
+        const PrecomputedValue& v = precomputed(idx);
+        return v.hasInteger ? v.integer : value(idx).toInt();
+    }
 
     const PropertyValue& value(Sid idx) const;
     double valueAbsolute(Sid idx) const;
@@ -92,7 +97,29 @@ private:
     bool readStyleValCompat(XmlReader&);
     bool readTextStyleValCompat(XmlReader&);
 
+    //---------------------------------------------------------
+    //   PrecomputedValue
+    //    The value of a Sid in the form the typed getters
+    //    return it, so they don't need to convert a PropertyValue
+    //---------------------------------------------------------
+
+    struct PrecomputedValue {
+        double real = 0.0;      // REAL, or SPATIUM in spatium units
+        double absolute = 0.0;  // SPATIUM multiplied by the spatium
+        int integer = 0;        // BOOL, INT and enums
+        bool hasInteger = true;
+    };
+
+    static const PrecomputedValue NO_VALUE;
+
+    const PrecomputedValue& precomputed(Sid idx) const
+    {
+        return idx == Sid::NOSTYLE ? NO_VALUE : m_precomputedValues[size_t(idx)];
+    }
+
+    void precomputeValue(Sid idx, double spatium);
+
     std::array<PropertyValue, size_t(Sid::STYLES)> m_values;
-    std::array<double, size_t(Sid::STYLES)> m_precomputedValues;
+    std::array<PrecomputedValue, size_t(Sid::STYLES)> m_precomputedValues;
 };
 }
@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "engraving/types/propertyvalue.h"
+
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   allocation counting
+//    Only counts while s_countAllocations is set
+//---------------------------------------------------------
+
+static std::atomic<bool> s_countAllocations = false;
+static std::atomic<size_t> s_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    if (s_countAllocations.load(std::memory_order_relaxed)) {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+template<typename Func>
+static size_t countAllocations(Func f)
+{
+    s_allocations = 0;
+    s_countAllocations = true;
+    f();
+    s_countAllocations = false;
+    return s_allocations;
+}
+
+class Engraving_AllocationTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_AllocationTests, smallValuesDontAllocate)
+{
+    size_t allocations = countAllocations([]() {
+        PropertyValue b(true);
+        PropertyValue i(42);
+        PropertyValue r(0.5);
+        PropertyValue sp(Spatium(1.5));
+        PropertyValue f(Fraction(3, 8));
+        PropertyValue p(PointF(1.0, 2.0));
+        PropertyValue c(Color(10, 20, 30));
+        PropertyValue e(DirectionV::UP);
+
+        PropertyValue copy = p;
+        PropertyValue moved = std::move(copy);
+        moved = f;
+
+        EXPECT_TRUE(b.toBool());
+        EXPECT_EQ(i.toInt(), 42);
+        EXPECT_DOUBLE_EQ(r.toReal(), 0.5);
+        EXPECT_DOUBLE_EQ(sp.value<Spatium>().val(), 1.5);
+        EXPECT_EQ(moved.value<Fraction>(), Fraction(3, 8));
+        EXPECT_EQ(p.value<PointF>(), PointF(1.0, 2.0));
+        EXPECT_EQ(c.value<Color>(), Color(10, 20, 30));
+        EXPECT_EQ(e.value<DirectionV>(), DirectionV::UP);
+    });
+
+    EXPECT_EQ(allocations, 0);
+}
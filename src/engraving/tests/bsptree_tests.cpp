@@ -24,6 +24,7 @@
 
 #include "engraving/dom/bsp.h"
 #include "engraving/dom/page.h"
+#include "engraving/rendering/score/paint.h"
 
 #include "utils/scorerw.h"
 
@@ -84,3 +85,161 @@ TEST_F(Engraving_BspTreeTests, NearestNeighbor)
         EXPECT_EQ(nn, singleNote);
     }
 }
+
+static bool displayListIsSorted(const std::vector<Page::DisplayItem>& displayList)
+{
+    return std::is_sorted(displayList.begin(), displayList.end(), [](const Page::DisplayItem& i1, const Page::DisplayItem& i2) {
+        return i1.z < i2.z || (i1.z == i2.z && i1.track < i2.track);
+    });
+}
+
+static bool displayIndexesMatch(Page* page, const std::vector<Page::DisplayItem>& displayList)
+{
+    for (size_t i = 0; i < displayList.size(); ++i) {
+        if (page->displayIndex(displayList.at(i).item) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Engraving_BspTreeTests_DisplayList
+ * @details Check that the page display list contains the same items as the bsp tree,
+ *          ordered by z, and stays ordered when an item is restacked
+ */
+TEST_F(Engraving_BspTreeTests, DisplayList)
+{
+    Score* score = ScoreRW::readScore(BSPTREE_DATA_DIR + u"nearest_neighbor.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    ASSERT_TRUE(page);
+
+    // [GIVEN] The display list of a laid out page
+    const std::vector<Page::DisplayItem>& displayList = page->displayList();
+    ASSERT_FALSE(displayList.empty());
+
+    // [THEN] It is ordered and contains the items of the bsp tree
+    EXPECT_TRUE(displayListIsSorted(displayList));
+    EXPECT_TRUE(displayIndexesMatch(page, displayList));
+
+    std::vector<EngravingItem*> bspItems = page->items(page->pageBoundingRect());
+    std::set<EngravingItem*> displayItems;
+    for (const Page::DisplayItem& di : displayList) {
+        displayItems.insert(di.item);
+    }
+    EXPECT_EQ(displayItems, std::set<EngravingItem*>(bspItems.begin(), bspItems.end()));
+
+    // [WHEN] A note is moved on top of everything else
+    EngravingItem* note = nullptr;
+    for (const Page::DisplayItem& di : displayList) {
+        if (di.item->isNote()) {
+            note = di.item;
+            break;
+        }
+    }
+    ASSERT_TRUE(note);
+
+    note->setZ(displayList.back().z + 1);
+    page->invalidateBspTree();
+
+    // [THEN] The note is drawn last and the list is still ordered
+    const std::vector<Page::DisplayItem>& updatedList = page->displayList();
+    EXPECT_EQ(updatedList.size(), displayItems.size());
+    EXPECT_EQ(updatedList.back().item, note);
+    EXPECT_TRUE(displayListIsSorted(updatedList));
+    EXPECT_TRUE(displayIndexesMatch(page, updatedList));
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_BspTreeTests_DrawingOrder
+ * @details Check that the items found in the tree for a part of the page are in the order of the display list
+ */
+TEST_F(Engraving_BspTreeTests, DrawingOrder)
+{
+    Score* score = ScoreRW::readScore(BSPTREE_DATA_DIR + u"nearest_neighbor.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    ASSERT_TRUE(page);
+
+    // [GIVEN] The top half of a page without selected items
+    RectF rect = page->pageBoundingRect();
+    rect.setHeight(rect.height() / 2);
+
+    // [WHEN] The items to draw are collected
+    std::vector<EngravingItem*> items = rendering::score::Paint::pageItemsInDrawingOrder(page, rect);
+
+    // [THEN] They are the display list items intersecting the rect, in the same order
+    std::vector<EngravingItem*> expected;
+    for (const Page::DisplayItem& di : page->displayList()) {
+        if (di.item->pageBoundingRect().intersects(rect) && di.item->visible()) {
+            expected.push_back(di.item);
+        }
+    }
+    ASSERT_FALSE(expected.empty());
+
+    std::vector<EngravingItem*> visibleItems;
+    for (EngravingItem* item : items) {
+        if (item->visible()) {
+            visibleItems.push_back(item);
+        }
+    }
+    EXPECT_EQ(items.size(), page->items(rect).size());
+    EXPECT_EQ(visibleItems, expected);
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_BspTreeTests_IncrementalUpdate
+ * @details Check that updating the page tree after items moved gives the same result as building it from scratch
+ */
+TEST_F(Engraving_BspTreeTests, IncrementalUpdate)
+{
+    Score* score = ScoreRW::readScore(BSPTREE_DATA_DIR + u"nearest_neighbor.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    ASSERT_TRUE(page);
+
+    // [GIVEN] A page with a valid tree
+    const RectF pageRect = page->pageBoundingRect();
+    std::vector<EngravingItem*> allItems = page->items(pageRect);
+    ASSERT_FALSE(allItems.empty());
+
+    // [WHEN] Some notes are moved and the tree is updated
+    std::vector<EngravingItem*> movedNotes;
+    for (EngravingItem* item : allItems) {
+        if (item->isNote() && movedNotes.size() < 3) {
+            item->move(PointF(pageRect.width() / 2, pageRect.height() / 3));
+            movedNotes.push_back(item);
+        }
+    }
+    ASSERT_FALSE(movedNotes.empty());
+
+    page->invalidateBspTree();
+
+    // [THEN] Queries give the same items as a tree built from scratch
+    BspTree bsp;
+    bsp.initialize(pageRect, static_cast<int>(allItems.size()));
+    for (EngravingItem* item : allItems) {
+        bsp.insert(item);
+    }
+
+    for (const EngravingItem* note : movedNotes) {
+        const RectF noteRect = note->pageBoundingRect();
+        std::vector<EngravingItem*> expected = bsp.items(noteRect);
+        std::vector<EngravingItem*> actual = page->items(noteRect);
+        EXPECT_EQ(std::set<EngravingItem*>(actual.begin(), actual.end()), std::set<EngravingItem*>(expected.begin(), expected.end()));
+        EXPECT_NE(std::find(actual.begin(), actual.end(), note), actual.end());
+    }
+
+    std::vector<EngravingItem*> actualAll = page->items(pageRect);
+    EXPECT_EQ(actualAll.size(), allItems.size());
+
+    delete score;
+}
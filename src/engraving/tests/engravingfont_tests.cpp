@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "io/file.h"
+
+#include "engraving/internal/engravingfont.h"
+
+#include "global/modularity/ioc.h"
+
+#include "mocks/engravingconfigurationmock.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+using ECMock = ::testing::NiceMock<EngravingConfigurationMock>;
+
+static const muse::io::path_t LELAND_PATH(":/fonts/leland/Leland.otf");
+static const muse::io::path_t LELAND_METADATA_PATH(":/fonts/leland/metadata.json");
+
+class Engraving_EngravingFontTests : public ::testing::Test
+{
+};
+
+/**
+ * @brief Engraving_EngravingFontTests_metricsCache
+ * @details A font loaded from the metrics cache has the same metrics as the font computed from scratch
+ */
+TEST_F(Engraving_EngravingFontTests, metricsCache)
+{
+    auto configuration = muse::modularity::globalIoc()->resolve<IEngravingConfiguration>("utests");
+    ECMock* mock = dynamic_cast<ECMock*>(configuration.get());
+    ASSERT_TRUE(mock);
+
+    std::filesystem::path appDataDir = std::filesystem::temp_directory_path() / "engravingfont_tests";
+    std::filesystem::remove_all(appDataDir);
+    muse::io::path_t appDataPath(appDataDir.string());
+
+    ON_CALL(*mock, appDataPath()).WillByDefault(::testing::Return(appDataPath));
+
+    // [GIVEN] A font which computes its metrics and writes the cache
+    EngravingFont computed("Leland", "Leland", LELAND_PATH, LELAND_METADATA_PATH);
+    computed.ensureLoad();
+    EXPECT_FALSE(computed.isLoadedFromMetricsCache());
+    EXPECT_TRUE(muse::io::File::exists(appDataPath + "/fontmetrics/Leland.bin"));
+
+    // [WHEN] The same font is loaded again
+    EngravingFont cached("Leland", "Leland", LELAND_PATH, LELAND_METADATA_PATH);
+    cached.ensureLoad();
+
+    // [THEN] It is read from the cache
+    EXPECT_TRUE(cached.isLoadedFromMetricsCache());
+
+    ON_CALL(*mock, appDataPath()).WillByDefault(::testing::Return(muse::io::path_t()));
+
+    // [THEN] The metrics are the same
+    for (int i = 0; i <= static_cast<int>(SymId::lastSym); ++i) {
+        SymId id = static_cast<SymId>(i);
+        EXPECT_EQ(cached.isValid(id), computed.isValid(id));
+        if (!computed.isValid(id)) {
+            continue;
+        }
+
+        EXPECT_EQ(cached.symCode(id), computed.symCode(id));
+        EXPECT_EQ(cached.bbox(id, 1.0), computed.bbox(id, 1.0));
+        EXPECT_DOUBLE_EQ(cached.advance(id, 1.0), computed.advance(id, 1.0));
+        EXPECT_EQ(cached.smuflAnchor(id, SmuflAnchorId::stemUpSE, 1.0), computed.smuflAnchor(id, SmuflAnchorId::stemUpSE, 1.0));
+        EXPECT_EQ(cached.smuflAnchor(id, SmuflAnchorId::cutOutNE, 1.0), computed.smuflAnchor(id, SmuflAnchorId::cutOutNE, 1.0));
+        EXPECT_EQ(cached.shapeWithCutouts(id, 1.0).bbox(), computed.shapeWithCutouts(id, 1.0).bbox());
+        EXPECT_EQ(cached.shapeWithCutouts(id, 1.0).size(), computed.shapeWithCutouts(id, 1.0).size());
+    }
+
+    EXPECT_EQ(cached.engravingDefaults(), computed.engravingDefaults());
+    EXPECT_DOUBLE_EQ(cached.textEnclosureThickness(), computed.textEnclosureThickness());
+
+    std::filesystem::remove_all(appDataDir);
+}
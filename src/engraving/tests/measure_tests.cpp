@@ -671,3 +671,79 @@ TEST_F(Engraving_MeasureTests, MMRestContinuationCourtesies) {
     EXPECT_TRUE(m3MMR && m3MMR->isMMRest());
     checkSegmentsAndItems(m3MMR, true);
 }
+
+//---------------------------------------------------------
+//   findSegmentLinear
+//    reference lookup walking the segment list
+//---------------------------------------------------------
+
+static Segment* findSegmentLinear(const Measure* m, SegmentType st, const Fraction& rtick, bool first)
+{
+    Segment* found = nullptr;
+    for (Segment* s = m->first(); s; s = s->next()) {
+        if (s->rtick() == rtick && (s->segmentType() & st)) {
+            if (first) {
+                return s;
+            }
+            found = s;
+        }
+    }
+    return found;
+}
+
+static void checkTickIndex(const Score* score)
+{
+    for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        for (const Segment* s = m->first(); s; s = s->next()) {
+            // segments at the end of a measure belong to the next one for tick2segment
+            const Measure* tickMeasure = score->tick2measure(s->tick());
+            for (SegmentType st : { s->segmentType(), SegmentType::All, SegmentType::ChordRest }) {
+                EXPECT_EQ(m->findSegmentR(st, s->rtick()), findSegmentLinear(m, st, s->rtick(), true));
+                if (tickMeasure) {
+                    EXPECT_EQ(score->tick2segment(s->tick(), false, st),
+                              findSegmentLinear(tickMeasure, st, s->tick() - tickMeasure->tick(), false));
+                }
+            }
+        }
+    }
+}
+
+TEST_F(Engraving_MeasureTests, segmentTickIndex)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    EXPECT_TRUE(score);
+
+    // [THEN] Lookups by tick give the same result as walking the segment list
+    checkTickIndex(score);
+
+    // [WHEN] Measures and segments are added
+    score->startCmd(TranslatableString::untranslatable("Engraving measure tests"));
+    score->insertMeasure(score->firstMeasure()->nextMeasure());
+    score->endCmd();
+
+    Measure* m = score->firstMeasure();
+    Segment* last = m->last();
+    score->startCmd(TranslatableString::untranslatable("Engraving measure tests"));
+    Segment* breath = m->undoGetSegmentR(SegmentType::Breath, last->rtick());
+    score->endCmd();
+    EXPECT_TRUE(breath);
+    EXPECT_EQ(m->findSegmentR(SegmentType::Breath, last->rtick()), breath);
+    checkTickIndex(score);
+
+    // [WHEN] A segment changes its tick without being reinserted
+    Segment* cr = m->first(SegmentType::ChordRest);
+    EXPECT_TRUE(cr);
+    Fraction oldTick = cr->rtick();
+    cr->setRtick(oldTick + Fraction(1, 64));
+    // [THEN] It is found at its new tick only
+    EXPECT_EQ(m->findSegmentR(SegmentType::ChordRest, oldTick + Fraction(1, 64)), cr);
+    EXPECT_NE(m->findSegmentR(SegmentType::ChordRest, oldTick), cr);
+    cr->setRtick(oldTick);
+    checkTickIndex(score);
+
+    // [WHEN] The insertion is undone
+    score->undoRedo(/*undo*/ true, /*EditData*/ nullptr);
+    checkTickIndex(score);
+
+    delete score;
+}
@@ -22,13 +22,19 @@
 
 #include <gtest/gtest.h>
 
+#include "global/modularity/ioc.h"
+
 #include "utils/scorerw.h"
 #include "engraving/compat/midi/compatmidirender.h"
 #include "engraving/rw/mscloader.h"
 #include "engraving/dom/noteevent.h"
 
+#include "mocks/engravingconfigurationmock.h"
+
 using namespace mu::engraving;
 
+using ECMock = ::testing::NiceMock<EngravingConfigurationMock>;
+
 class MidiRenderer_Tests : public ::testing::Test
 {
 };
@@ -1092,3 +1098,73 @@ TEST_F(MidiRenderer_Tests, vibrato)
 
     EXPECT_TRUE(events[DEFAULT_CHANNEL].empty());
 }
+
+//---------------------------------------------------------
+//   parallelRendering
+//    Rendering the staves concurrently gives the same
+//    events in the same order as rendering them one after
+//    another
+//---------------------------------------------------------
+
+static EventsHolder renderScoreEvents(const String& path, bool parallel)
+{
+    auto configuration = muse::modularity::globalIoc()->resolve<IEngravingConfiguration>("utests");
+    ECMock* mock = dynamic_cast<ECMock*>(configuration.get());
+    EXPECT_TRUE(mock);
+
+    MasterScore* score = ScoreRW::readScore(path);
+    EXPECT_TRUE(score);
+
+    EventsHolder events;
+    if (!mock || !score) {
+        delete score;
+        return events;
+    }
+
+    CompatMidiRendererInternal::Context ctx;
+    ctx.applyCaesuras = true;
+
+    ON_CALL(*mock, parallelMidiRendering()).WillByDefault(::testing::Return(parallel));
+    CompatMidiRender::renderScore(score, events, ctx, true);
+    ON_CALL(*mock, parallelMidiRendering()).WillByDefault(::testing::Return(false));
+
+    delete score;
+    return events;
+}
+
+static void checkParallelRendering(const String& path)
+{
+    EventsHolder serialEvents = renderScoreEvents(path, false);
+    EventsHolder parallelEvents = renderScoreEvents(path, true);
+
+    ASSERT_EQ(parallelEvents.size(), serialEvents.size());
+
+    size_t eventCount = 0;
+    for (size_t channel = 0; channel < serialEvents.size(); ++channel) {
+        const auto& serial = serialEvents[channel];
+        const auto& parallel = parallelEvents[channel];
+        ASSERT_EQ(parallel.size(), serial.size());
+
+        for (auto s = serial.cbegin(), p = parallel.cbegin(); s != serial.cend(); ++s, ++p) {
+            EXPECT_EQ(p->first, s->first);
+            EXPECT_EQ(p->second.type(), s->second.type());
+            EXPECT_EQ(p->second.channel(), s->second.channel());
+            EXPECT_EQ(p->second.dataA(), s->second.dataA());
+            EXPECT_EQ(p->second.dataB(), s->second.dataB());
+            EXPECT_EQ(p->second.effect(), s->second.effect());
+            EXPECT_EQ(p->second.getOriginatingStaff(), s->second.getOriginatingStaff());
+            EXPECT_EQ(p->second.discard(), s->second.discard());
+            ++eventCount;
+        }
+    }
+
+    EXPECT_GT(eventCount, 0);
+}
+
+TEST_F(MidiRenderer_Tests, parallelRendering)
+{
+    checkParallelRendering(MIDIRENDERER_TESTS_DIR + u"hairpin_two_instruments.mscx");
+    checkParallelRendering(MIDIRENDERER_TESTS_DIR + u"same_string_diff_staves.mscx");
+    checkParallelRendering(u"all_elements_data/moonlight.mscx");
+    checkParallelRendering(u"all_elements_data/layout_elements.mscx");
+}
@@ -93,6 +93,15 @@ public:
     MOCK_METHOD(bool, doNotSaveEIDsForBackCompat, (), (const, override));
     MOCK_METHOD(void, setDoNotSaveEIDsForBackCompat, (bool), (override));
 
+    MOCK_METHOD(size_t, undoMemoryBudget, (), (const, override));
+
+    MOCK_METHOD(bool, parallelExcerptsReading, (), (const, override));
+    MOCK_METHOD(bool, deferredExcerptsReading, (), (const, override));
+
+    MOCK_METHOD(bool, parallelMidiRendering, (), (const, override));
+
+    MOCK_METHOD(bool, incrementalPlaybackUpdate, (), (const, override));
+
     MOCK_METHOD(bool, allowReadingImagesFromOutsideMscz, (), (const, override));
 
     MOCK_METHOD(bool, guitarProImportExperimental, (), (const, override));
@@ -22,6 +22,7 @@
 
 #include <gtest/gtest.h>
 
+#include "io/buffer.h"
 #include "io/fileinfo.h"
 
 #include "engraving/dom/breath.h"
@@ -41,14 +42,21 @@
 #include "engraving/dom/segment.h"
 #include "engraving/dom/spanner.h"
 #include "engraving/dom/staff.h"
+#include "engraving/rw/rwregister.h"
+
+#include "global/modularity/ioc.h"
+
+#include "mocks/engravingconfigurationmock.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 #include "utils/testutils.h"
 
 using namespace mu::engraving;
+using ECMock = ::testing::NiceMock<EngravingConfigurationMock>;
 
 static const String PARTS_DATA_DIR("parts_data/");
+static const String READ_EXCERPTS_FILE(PARTS_DATA_DIR + u"read-excerpts.mscz"); // 4.70, two closed parts
 
 class Engraving_PartsTests : public ::testing::Test
 {
@@ -389,6 +397,113 @@ TEST_F(Engraving_PartsTests, addBreath)
     delete score;
 }
 
+//---------------------------------------------------------
+//   parallelExcerptsReading
+//    Reading the part scores concurrently gives the same
+//    part scores as reading them one after another
+//---------------------------------------------------------
+
+static std::vector<muse::ByteArray> excerptsData(MasterScore* score)
+{
+    std::vector<muse::ByteArray> data;
+    for (Excerpt* ex : score->excerpts()) {
+        auto buffer = muse::io::Buffer::opened(muse::io::IODevice::WriteOnly);
+        rw::RWRegister::writer()->writeScore(ex->excerptScore(), &buffer);
+        data.push_back(buffer.data());
+    }
+    return data;
+}
+
+static std::vector<ID> excerptPartIds(const Excerpt* ex)
+{
+    std::vector<ID> ids;
+    for (const Part* part : ex->parts()) {
+        ids.push_back(part->id());
+    }
+    return ids;
+}
+
+TEST_F(Engraving_PartsTests, parallelExcerptsReading)
+{
+    auto configuration = muse::modularity::globalIoc()->resolve<IEngravingConfiguration>("utests");
+    ECMock* mock = dynamic_cast<ECMock*>(configuration.get());
+    ASSERT_TRUE(mock);
+
+    MasterScore* serialScore = ScoreRW::readScore(READ_EXCERPTS_FILE);
+
+    ON_CALL(*mock, parallelExcerptsReading()).WillByDefault(::testing::Return(true));
+    MasterScore* parallelScore = ScoreRW::readScore(READ_EXCERPTS_FILE);
+    ON_CALL(*mock, parallelExcerptsReading()).WillByDefault(::testing::Return(false));
+
+    ASSERT_TRUE(serialScore && parallelScore);
+    ASSERT_EQ(parallelScore->excerpts().size(), 2);
+    ASSERT_EQ(parallelScore->excerpts().size(), serialScore->excerpts().size());
+
+    for (size_t i = 0; i < serialScore->excerpts().size(); ++i) {
+        EXPECT_EQ(parallelScore->excerpts().at(i)->name(), serialScore->excerpts().at(i)->name());
+        EXPECT_EQ(excerptPartIds(parallelScore->excerpts().at(i)), excerptPartIds(serialScore->excerpts().at(i)));
+    }
+    EXPECT_EQ(excerptsData(parallelScore), excerptsData(serialScore));
+
+    delete serialScore;
+    delete parallelScore;
+}
+
+//---------------------------------------------------------
+//   deferredExcerptsReading
+//---------------------------------------------------------
+
+TEST_F(Engraving_PartsTests, deferredExcerptsReading)
+{
+    auto configuration = muse::modularity::globalIoc()->resolve<IEngravingConfiguration>("utests");
+    ECMock* mock = dynamic_cast<ECMock*>(configuration.get());
+    ASSERT_TRUE(mock);
+
+    MasterScore* score = ScoreRW::readScore(READ_EXCERPTS_FILE);
+
+    // [GIVEN] A file read with deferred part scores
+    ON_CALL(*mock, deferredExcerptsReading()).WillByDefault(::testing::Return(true));
+    MasterScore* deferredScore = ScoreRW::readScore(READ_EXCERPTS_FILE);
+    ON_CALL(*mock, deferredExcerptsReading()).WillByDefault(::testing::Return(false));
+
+    ASSERT_TRUE(score && deferredScore);
+    ASSERT_EQ(deferredScore->excerpts().size(), score->excerpts().size());
+
+    // [THEN] The part scores are listed without being read
+    EXPECT_EQ(deferredScore->scoreList().size(), 1);
+    for (size_t i = 0; i < score->excerpts().size(); ++i) {
+        const Excerpt* ex = deferredScore->excerpts().at(i);
+        EXPECT_TRUE(ex->isDeferred());
+        EXPECT_FALSE(ex->isEmpty());
+        EXPECT_EQ(ex->name(), score->excerpts().at(i)->name());
+        EXPECT_EQ(ex->initialPartId(), score->excerpts().at(i)->initialPartId());
+        EXPECT_EQ(excerptPartIds(ex), excerptPartIds(score->excerpts().at(i)));
+    }
+
+    // [THEN] Asking for the part score doesn't read it
+    EXPECT_EQ(deferredScore->excerpts().front()->excerptScore(), nullptr);
+
+    // [WHEN] The first part score is needed
+    Score* partScore = deferredScore->excerpts().front()->ensureExcerptLoaded();
+
+    // [THEN] Only that one is read
+    ASSERT_TRUE(partScore);
+    EXPECT_FALSE(deferredScore->excerpts().front()->isDeferred());
+    EXPECT_TRUE(deferredScore->excerpts().back()->isDeferred());
+    EXPECT_EQ(deferredScore->scoreList().size(), 2);
+
+    // [WHEN] The score is edited
+    deferredScore->startCmd(TranslatableString::untranslatable("Deferred excerpts test"));
+    deferredScore->endCmd();
+
+    // [THEN] All part scores are read, the same as without deferring
+    EXPECT_EQ(deferredScore->scoreList().size(), 3);
+    EXPECT_EQ(excerptsData(deferredScore), excerptsData(score));
+
+    delete score;
+    delete deferredScore;
+}
+
 //---------------------------------------------------------
 //   undoAddBreath
 //---------------------------------------------------------
@@ -32,15 +32,22 @@
 #include "engraving/dom/part.h"
 #include "engraving/dom/measure.h"
 #include "engraving/dom/chord.h"
+#include "engraving/dom/dynamic.h"
+#include "engraving/dom/note.h"
+#include "engraving/editing/undo.h"
 
 #include "engraving/playback/playbackmodel.h"
 
 #include "utils/scorerw.h"
 
+#include "mocks/engravingconfigurationmock.h"
+
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::_;
 
+using ECMock = ::testing::NiceMock<mu::engraving::EngravingConfigurationMock>;
+
 using namespace mu::engraving;
 using namespace muse::mpe;
 using namespace muse;
@@ -1406,3 +1413,115 @@ TEST_F(Engraving_PlaybackModelTests, Playback_Setup_Data_MultiInstrument)
         }
     }
 }
+
+static void checkSamePlaybackData(const PlaybackData& actual, const PlaybackData& expected)
+{
+    EXPECT_EQ(actual.dynamics, expected.dynamics);
+
+    ASSERT_EQ(actual.originEvents.size(), expected.originEvents.size());
+    auto actualIt = actual.originEvents.cbegin();
+    auto expectedIt = expected.originEvents.cbegin();
+    for (; actualIt != actual.originEvents.cend(); ++actualIt, ++expectedIt) {
+        EXPECT_EQ(actualIt->first, expectedIt->first);
+        EXPECT_EQ(actualIt->second.size(), expectedIt->second.size());
+    }
+}
+
+/**
+ * @brief PlaybackModelTests_Incremental_Update
+ * @details Edit a note inside a repeat and a dynamic between two hairpins with the incremental update enabled.
+ *          The updated events and dynamics must match those of a model loaded from scratch
+ */
+TEST_F(Engraving_PlaybackModelTests, Incremental_Update)
+{
+    auto configuration = muse::modularity::globalIoc()->resolve<IEngravingConfiguration>("utests");
+    ECMock* configurationMock = dynamic_cast<ECMock*>(configuration.get());
+    ASSERT_TRUE(configurationMock);
+
+    ON_CALL(*m_repositoryMock, defaultProfile(_)).WillByDefault(Return(m_defaultProfile));
+    ON_CALL(*configurationMock, incrementalPlaybackUpdate()).WillByDefault(Return(true));
+
+    // [GIVEN] Score with a repeat from measure 2 up to measure 3
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "repeat_range/repeat_range.mscx");
+    ASSERT_TRUE(score);
+
+    const Part* part = score->parts().at(0);
+    InstrumentTrackId trackId { part->id(), part->instrumentId() };
+
+    PlaybackModel model(modularity::globalCtx());
+    model.profilesRepository.set(m_repositoryMock);
+    model.load(score);
+
+    // [WHEN] The pitch of the 1st note of the 3rd measure (inside the repeat) is changed
+    Chord* chord = score->tick2measure(Fraction::fromTicks(3840))->findChord(Fraction::fromTicks(3840), 0);
+    ASSERT_TRUE(chord);
+    Note* note = chord->upNote();
+    note->setPitch(note->pitch() + 1);
+    note->setTpcFromPitch();
+
+    ScoreChanges changes;
+    changes.tickFrom = 3840;
+    changes.tickTo = 3840;
+    changes.staffIdxFrom = 0;
+    changes.staffIdxTo = 0;
+    changes.changedTypes = { ElementType::NOTE };
+    changes.changedObjects[note] = { CommandType::ChangeProperty };
+
+    score->changesChannel().send(changes);
+
+    // [THEN] The events of both passes of the repeat match a full reload
+    PlaybackModel expectedModel(modularity::globalCtx());
+    expectedModel.profilesRepository.set(m_repositoryMock);
+    expectedModel.load(score);
+
+    checkSamePlaybackData(model.resolveTrackPlaybackData(trackId), expectedModel.resolveTrackPlaybackData(trackId));
+
+    delete score;
+
+    // [GIVEN] Score with a crescendo to forte, followed by another crescendo
+    score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "dynamics/dynamics.mscx");
+    ASSERT_TRUE(score);
+
+    part = score->parts().at(0);
+    trackId = { part->id(), part->instrumentId() };
+
+    PlaybackModel dynamicsModel(modularity::globalCtx());
+    dynamicsModel.profilesRepository.set(m_repositoryMock);
+    dynamicsModel.load(score);
+
+    // [WHEN] The forte is changed to fortissimo
+    Dynamic* forte = nullptr;
+    for (Segment* segment = score->firstSegment(SegmentType::ChordRest); segment && !forte;
+         segment = segment->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* annotation : segment->annotations()) {
+            if (annotation->isDynamic() && toDynamic(annotation)->dynamicType() == mu::engraving::DynamicType::F) {
+                forte = toDynamic(annotation);
+                break;
+            }
+        }
+    }
+
+    ASSERT_TRUE(forte);
+    forte->setDynamicType(mu::engraving::DynamicType::FF);
+
+    changes = ScoreChanges();
+    changes.tickFrom = forte->tick().ticks();
+    changes.tickTo = forte->tick().ticks();
+    changes.staffIdxFrom = 0;
+    changes.staffIdxTo = 0;
+    changes.changedTypes = { ElementType::DYNAMIC };
+    changes.changedObjects[forte] = { CommandType::ChangeProperty };
+
+    score->changesChannel().send(changes);
+
+    // [THEN] The patched dynamics match those of a full reload
+    PlaybackModel expectedDynamicsModel(modularity::globalCtx());
+    expectedDynamicsModel.profilesRepository.set(m_repositoryMock);
+    expectedDynamicsModel.load(score);
+
+    checkSamePlaybackData(dynamicsModel.resolveTrackPlaybackData(trackId), expectedDynamicsModel.resolveTrackPlaybackData(trackId));
+
+    ON_CALL(*configurationMock, incrementalPlaybackUpdate()).WillByDefault(Return(false));
+
+    delete score;
+}
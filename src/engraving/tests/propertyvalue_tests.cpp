@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "engraving/types/propertyvalue.h"
+
+using namespace mu::engraving;
+
+class Engraving_PropertyValueTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_PropertyValueTests, heapValues)
+{
+    PropertyValue s(String(u"text"));
+    PropertyValue v(std::vector<int> { 1, 2, 3 });
+
+    PropertyValue sCopy = s;
+    PropertyValue vCopy;
+    vCopy = v;
+
+    EXPECT_EQ(sCopy.value<String>(), u"text");
+    EXPECT_EQ(vCopy.value<std::vector<int> >(), (std::vector<int> { 1, 2, 3 }));
+    EXPECT_EQ(s, sCopy);
+    EXPECT_EQ(v, vCopy);
+
+    // switching between inline and heap storage
+    sCopy = PropertyValue(7);
+    EXPECT_EQ(sCopy.toInt(), 7);
+    sCopy = v;
+    EXPECT_EQ(sCopy, v);
+}
+
+TEST_F(Engraving_PropertyValueTests, conversions)
+{
+    // same conversions as before inline storage
+    EXPECT_EQ(PropertyValue(DirectionV::DOWN).value<int>(), static_cast<int>(DirectionV::DOWN));
+    EXPECT_EQ(PropertyValue(static_cast<int>(DirectionV::DOWN)).value<DirectionV>(), DirectionV::DOWN);
+    EXPECT_EQ(PropertyValue(true).value<int>(), 1);
+    EXPECT_TRUE(PropertyValue(1).value<bool>());
+    EXPECT_DOUBLE_EQ(PropertyValue(2.0).value<Spatium>().val(), 2.0);
+    EXPECT_DOUBLE_EQ(PropertyValue(Spatium(2.0)).value<double>(), 2.0);
+    EXPECT_TRUE(PropertyValue(DirectionV::UP).isEnum());
+    EXPECT_FALSE(PropertyValue(1).isEnum());
+
+    EXPECT_EQ(PropertyValue(true), PropertyValue(1));
+    EXPECT_EQ(PropertyValue(Spatium(1.0)), PropertyValue(1.0));
+    EXPECT_NE(PropertyValue(PointF(1.0, 2.0)), PropertyValue(PointF(2.0, 1.0)));
+    EXPECT_EQ(PropertyValue(), PropertyValue());
+    EXPECT_NE(PropertyValue(), PropertyValue(0));
+}
@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/measure.h"
 #include "engraving/editing/undo.h"
 
 #include "utils/scorerw.h"
@@ -101,3 +102,102 @@ TEST_F(Engraving_ReadWriteUndoResetTests, testMMRestLinksRecreateMMRest)
 
     delete score;
 }
+
+//---------------------------------------------------------
+//   testUndoMemoryBudget
+///   The oldest macros are dropped once the history
+///   exceeds the memory budget, the latest ones can
+///   still be undone
+//---------------------------------------------------------
+
+TEST_F(Engraving_ReadWriteUndoResetTests, testUndoMemoryBudget)
+{
+    MasterScore* score = ScoreRW::readScore(RWUNDORESET_DATA_DIR + u"barlines.mscx");
+    ASSERT_TRUE(score);
+
+    UndoStack* undoStack = score->undoStack();
+    ASSERT_EQ(undoStack->size(), 0);
+
+    // [GIVEN] Five edits
+    const size_t editCount = 5;
+    for (size_t i = 0; i < editCount; ++i) {
+        score->startCmd(TranslatableString::untranslatable("Read/write/undo/reset tests"));
+        score->undoChangeStyleVal(Sid::createMultiMeasureRests, i % 2 == 0);
+        score->endCmd();
+    }
+
+    EXPECT_EQ(undoStack->size(), editCount);
+    EXPECT_GT(undoStack->memoryFootprint(), 0);
+    EXPECT_EQ(undoStack->droppedCount(), 0);
+
+    // [WHEN] The budget is too small for the history
+    undoStack->setMemoryBudget(1);
+
+    // [THEN] Only the last two edits are kept, indices don't change
+    EXPECT_EQ(undoStack->size(), editCount);
+    EXPECT_EQ(undoStack->droppedCount(), editCount - 2);
+    EXPECT_EQ(undoStack->lastAtIndex(1), nullptr);
+    EXPECT_TRUE(undoStack->lastAtIndex(editCount));
+
+    score->undoRedo(/* undo */ true, nullptr);
+    score->undoRedo(/* undo */ true, nullptr);
+    EXPECT_FALSE(undoStack->canUndo());
+    EXPECT_EQ(undoStack->currentIndex(), editCount - 2);
+
+    score->undoRedo(/* undo */ false, nullptr);
+    EXPECT_TRUE(undoStack->canUndo());
+
+    // [THEN] Dropped macros aren't merged, the stack is left as is
+    undoStack->mergeCommands(0);
+    EXPECT_EQ(undoStack->size(), editCount);
+    EXPECT_EQ(undoStack->currentIndex(), editCount - 1);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   testUndoMemoryBudgetRemovedMeasures
+///   Removed measures count towards the footprint, so a
+///   large removal is dropped first once over budget
+//---------------------------------------------------------
+
+TEST_F(Engraving_ReadWriteUndoResetTests, testUndoMemoryBudgetRemovedMeasures)
+{
+    MasterScore* score = ScoreRW::readScore(RWUNDORESET_DATA_DIR + u"barlines.mscx");
+    ASSERT_TRUE(score);
+
+    UndoStack* undoStack = score->undoStack();
+    const size_t measureCount = score->nmeasures();
+    ASSERT_GT(measureCount, 2);
+
+    // [GIVEN] A removal of all but the first and last measures
+    score->startCmd(TranslatableString::untranslatable("Read/write/undo/reset tests"));
+    score->deleteMeasures(score->firstMeasure()->next(), score->lastMeasure()->prev());
+    score->endCmd();
+
+    const size_t removedCount = measureCount - score->nmeasures();
+    ASSERT_GT(removedCount, 0);
+
+    const size_t removalFootprint = undoStack->memoryFootprint();
+    EXPECT_GE(removalFootprint, removedCount * sizeof(EngravingItem));
+
+    // [GIVEN] Two small edits after it
+    for (size_t i = 0; i < 2; ++i) {
+        score->startCmd(TranslatableString::untranslatable("Read/write/undo/reset tests"));
+        score->undoChangeStyleVal(Sid::createMultiMeasureRests, i % 2 == 0);
+        score->endCmd();
+    }
+
+    const size_t totalFootprint = undoStack->memoryFootprint();
+    EXPECT_EQ(undoStack->droppedCount(), 0);
+
+    // [WHEN] The budget fits the small edits but not the removal
+    undoStack->setMemoryBudget(totalFootprint - removalFootprint / 2);
+
+    // [THEN] Only the removal is dropped
+    EXPECT_EQ(undoStack->droppedCount(), 1);
+    EXPECT_EQ(undoStack->lastAtIndex(1), nullptr);
+    EXPECT_LT(undoStack->memoryFootprint(), removalFootprint);
+
+    delete score;
+}
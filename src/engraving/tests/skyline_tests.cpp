@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/system.h"
+#include "engraving/infrastructure/skyline.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu::engraving;
+
+static const String ALL_ELEMENTS_DATA_DIR(u"all_elements_data/");
+
+class Engraving_SkylineTests : public ::testing::Test
+{
+public:
+    void tstMinDistanceMatchesBruteForce(const String& file);
+};
+
+static Shape toShape(const SkylineLine& line)
+{
+    Shape shape;
+    for (const ShapeElement& el : line.elements()) {
+        shape.add(el);
+    }
+    return shape;
+}
+
+//---------------------------------------------------------
+//   tstMinDistanceMatchesBruteForce
+//    Compare the envelope based distance between adjacent
+//    staves of every system with the pairwise comparison
+//    of all shape elements
+//---------------------------------------------------------
+
+void Engraving_SkylineTests::tstMinDistanceMatchesBruteForce(const String& file)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + file);
+    ASSERT_TRUE(score);
+
+    size_t comparisons = 0;
+    for (const System* system : score->systems()) {
+        const std::vector<SysStaff*>& staves = system->staves();
+        for (size_t i = 0; i + 1 < staves.size(); ++i) {
+            const SkylineLine& south = staves.at(i)->skyline().south();
+            const SkylineLine& north = staves.at(i + 1)->skyline().north();
+            const Shape southShape = toShape(south);
+            const Shape northShape = toShape(north);
+
+            for (double clearance : { 0.0, score->style().spatium() }) {
+                EXPECT_DOUBLE_EQ(south.minDistance(north, clearance), southShape.minVerticalDistance(northShape, clearance));
+                EXPECT_DOUBLE_EQ(south.minDistanceToShapeBelow(northShape, clearance),
+                                 southShape.minVerticalDistance(northShape, clearance));
+                EXPECT_DOUBLE_EQ(north.minDistanceToShapeAbove(southShape, clearance),
+                                 southShape.minVerticalDistance(northShape, clearance));
+                ++comparisons;
+            }
+        }
+    }
+
+    EXPECT_GT(comparisons, 0);
+
+    delete score;
+}
+
+TEST_F(Engraving_SkylineTests, minDistanceLayoutElements)
+{
+    tstMinDistanceMatchesBruteForce(u"layout_elements.mscx");
+}
+
+TEST_F(Engraving_SkylineTests, minDistanceTablature)
+{
+    tstMinDistanceMatchesBruteForce(u"layout_elements_tab.mscx");
+}
+
+TEST_F(Engraving_SkylineTests, minDistanceMoonlight)
+{
+    tstMinDistanceMatchesBruteForce(u"moonlight.mscx");
+}
+
+TEST_F(Engraving_SkylineTests, minDistanceRandomElements)
+{
+    tstMinDistanceMatchesBruteForce(u"random_elements.mscx");
+}
+
+TEST_F(Engraving_SkylineTests, minDistanceCrossStaffArp)
+{
+    tstMinDistanceMatchesBruteForce(u"cross_staff_arp.mscx");
+}
+
+/**
+ * @brief Engraving_SkylineTests_Envelope
+ * @details Overlapping and touching elements are merged into one step per distinct height
+ */
+TEST_F(Engraving_SkylineTests, envelope)
+{
+    SkylineLine south(false);
+    south.add(RectF(0.0, 0.0, 10.0, 5.0), nullptr);
+    south.add(RectF(5.0, 0.0, 10.0, 8.0), nullptr);
+    south.add(RectF(15.0, 0.0, 5.0, 8.0), nullptr);
+    south.add(RectF(30.0, 0.0, 5.0, 2.0), nullptr);
+
+    const std::vector<SkylineEnvelope::Step>& steps = south.envelope().steps();
+    ASSERT_EQ(steps.size(), 3);
+    EXPECT_DOUBLE_EQ(steps.at(0).x1, 0.0);
+    EXPECT_DOUBLE_EQ(steps.at(0).x2, 5.0);
+    EXPECT_DOUBLE_EQ(steps.at(0).y, 5.0);
+    EXPECT_DOUBLE_EQ(steps.at(1).x1, 5.0);
+    EXPECT_DOUBLE_EQ(steps.at(1).x2, 20.0);
+    EXPECT_DOUBLE_EQ(steps.at(1).y, 8.0);
+    EXPECT_DOUBLE_EQ(steps.at(2).x1, 30.0);
+    EXPECT_DOUBLE_EQ(steps.at(2).x2, 35.0);
+    EXPECT_DOUBLE_EQ(steps.at(2).y, 2.0);
+
+    SkylineLine north(true);
+    north.add(RectF(20.0, 10.0, 10.0, 5.0), nullptr);
+
+    // touching ranges don't overlap
+    EXPECT_DOUBLE_EQ(south.minDistance(north), -DBL_MAX);
+    EXPECT_DOUBLE_EQ(south.minDistance(north, 1.0), -2.0);
+}
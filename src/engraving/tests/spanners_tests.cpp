@@ -22,6 +22,10 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <set>
+#include <tuple>
+
 #include "engraving/dom/chord.h"
 #include "engraving/dom/excerpt.h"
 #include "engraving/dom/factory.h"
@@ -644,3 +648,78 @@ TEST_F(Engraving_SpannersTests, spanners17_pluginAPI_scoreSpanners)
 
     delete score;
 }
+
+//---------------------------------------------------------
+///  spanners18
+///   Check that the lookup trees of SpannerMap are kept up to date
+///   in place when spanners are added, removed or change their ticks or track
+//---------------------------------------------------------
+
+static std::multiset<std::tuple<int, int, Spanner*> > toSet(const SpannerMap::IntervalList& intervals)
+{
+    std::multiset<std::tuple<int, int, Spanner*> > result;
+    for (const auto& interval : intervals) {
+        result.emplace(interval.start, interval.stop, interval.value);
+    }
+    return result;
+}
+
+static void checkSpannerMap(const SpannerMap& map)
+{
+    constexpr int endTick = std::numeric_limits<int>::max();
+
+    SpannerMap::IntervalList regularIntervals;
+    SpannerMap::IntervalList collisionFreeIntervals;
+    map.collectIntervals(regularIntervals, collisionFreeIntervals);
+
+    EXPECT_EQ(toSet(map.findOverlapping(0, endTick)), toSet(regularIntervals));
+    EXPECT_EQ(toSet(map.findOverlapping(0, endTick, true)), toSet(collisionFreeIntervals));
+}
+
+TEST_F(Engraving_SpannersTests, spanners18_incrementalSpannerMap)
+{
+    MasterScore* score = ScoreRW::readScore(SPANNERS_DATA_DIR + u"smallstaff01.mscx");
+    EXPECT_TRUE(score);
+
+    const SpannerMap& map = score->spannerMap();
+    const int endTick = std::numeric_limits<int>::max();
+    checkSpannerMap(map);
+
+    std::vector<Spanner*> spanners = score->spannerList();
+    ASSERT_FALSE(spanners.empty());
+
+    // [WHEN] A spanner is removed
+    Spanner* spanner = spanners.front();
+    score->removeSpanner(spanner);
+    // [THEN] It isn't found anymore
+    for (const auto& interval : map.findOverlapping(0, endTick)) {
+        EXPECT_NE(interval.value, spanner);
+    }
+    checkSpannerMap(map);
+
+    // [WHEN] It is shortened and added back
+    spanner->setTicks(Fraction(1, 4));
+    score->addSpanner(spanner, /*computeStartEnd =*/ false);
+    // [THEN] It is found with its new length only
+    const SpannerMap::IntervalList& found = map.findContained(spanner->tick().ticks(), spanner->tick2().ticks());
+    EXPECT_TRUE(std::any_of(found.begin(), found.end(), [spanner](const auto& interval) { return interval.value == spanner; }));
+    checkSpannerMap(map);
+
+    // [WHEN] Every spanner is moved and resized while being in the map
+    for (Spanner* s : spanners) {
+        s->setProperty(Pid::SPANNER_TICK, s->tick() + Fraction(1, 8));
+        s->setProperty(Pid::SPANNER_TICKS, s->ticks() + Fraction(1, 2));
+        // [THEN] The lookup trees reflect the change
+        checkSpannerMap(map);
+    }
+
+    // [WHEN] Every spanner is moved to another staff, not through the properties
+    const track_idx_t lastTrack = score->ntracks() - VOICES;
+    for (Spanner* s : spanners) {
+        s->setTrack(s->track() == lastTrack ? 0 : lastTrack);
+        // [THEN] The lookup trees reflect the change
+        checkSpannerMap(map);
+    }
+
+    delete score;
+}
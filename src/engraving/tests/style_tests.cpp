@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/style/style.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu::engraving;
+
+static const String ALL_ELEMENTS_DATA_DIR(u"all_elements_data/");
+
+class Engraving_StyleTests : public ::testing::Test
+{
+public:
+    void checkPrecomputedValues(const MStyle& style);
+};
+
+//---------------------------------------------------------
+//   checkPrecomputedValues
+//    The typed getters must return what converting the
+//    PropertyValue of every Sid returns
+//---------------------------------------------------------
+
+void Engraving_StyleTests::checkPrecomputedValues(const MStyle& style)
+{
+    const double spatium = style.value(Sid::spatium).toReal();
+
+    for (const StyleDef::StyleValue& styleValue : StyleDef::styleValues) {
+        const Sid sid = styleValue.sid;
+        const PropertyValue& value = style.value(sid);
+
+        switch (styleValue.valueType()) {
+        case P_TYPE::SPATIUM:
+            EXPECT_DOUBLE_EQ(style.styleS(sid).val(), value.value<Spatium>().val()) << MStyle::valueName(sid);
+            EXPECT_DOUBLE_EQ(style.styleAbsolute(sid), value.value<Spatium>().val() * spatium) << MStyle::valueName(sid);
+            break;
+        case P_TYPE::REAL:
+            EXPECT_DOUBLE_EQ(style.styleD(sid), value.toReal()) << MStyle::valueName(sid);
+            break;
+        case P_TYPE::BOOL:
+            EXPECT_EQ(style.styleB(sid), value.toBool()) << MStyle::valueName(sid);
+            break;
+        default:
+            break;
+        }
+
+        if (value.type() == P_TYPE::INT || value.type() == P_TYPE::BOOL || value.isEnum()) {
+            EXPECT_EQ(style.styleI(sid), value.toInt()) << MStyle::valueName(sid);
+        }
+    }
+}
+
+TEST_F(Engraving_StyleTests, precomputedDefaultValues)
+{
+    MStyle style;
+    checkPrecomputedValues(style);
+}
+
+TEST_F(Engraving_StyleTests, precomputedValuesFollowChanges)
+{
+    // [GIVEN] The style of a score read from file
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    MStyle style = score->style();
+    checkPrecomputedValues(style);
+
+    // [WHEN] Values of every kind are changed
+    style.set(Sid::staffDistance, Spatium(9.0));
+    style.set(Sid::hideEmptyStaves, !style.styleB(Sid::hideEmptyStaves));
+    style.set(Sid::tupletDirection, DirectionV::DOWN);
+    style.set(Sid::spatium, style.spatium() * 2);
+
+    // [THEN] The typed getters return the new values
+    checkPrecomputedValues(style);
+    EXPECT_DOUBLE_EQ(style.styleS(Sid::staffDistance).val(), 9.0);
+    EXPECT_DOUBLE_EQ(style.styleAbsolute(Sid::staffDistance), 9.0 * style.spatium());
+    EXPECT_EQ(style.styleB(Sid::hideEmptyStaves), !score->style().styleB(Sid::hideEmptyStaves));
+    EXPECT_EQ(style.styleI(Sid::tupletDirection), static_cast<int>(DirectionV::DOWN));
+    EXPECT_DOUBLE_EQ(style.spatium(), score->style().spatium() * 2);
+
+    delete score;
+}
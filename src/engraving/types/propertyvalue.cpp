@@ -69,17 +69,26 @@ bool PropertyValue::operator ==(const PropertyValue& v) const
         return muse::RealIsEqual(v.value<double>(), value<double>());
     }
 
-    assert(m_data);
-    if (!m_data) {
+    assert(hasData());
+    if (!hasData()) {
         return false;
     }
 
-    assert(v.m_data);
-    if (!v.m_data) {
+    assert(v.hasData());
+    if (!v.hasData()) {
         return false;
     }
 
-    return v.m_type == m_type && v.m_data->equal(m_data.get());
+    if (v.m_type != m_type) {
+        return false;
+    }
+
+    if (m_inlineOps || v.m_inlineOps) {
+        assert(m_inlineOps == v.m_inlineOps);
+        return m_inlineOps == v.m_inlineOps && m_inlineOps->equal(m_storage.bytes, v.m_storage.bytes);
+    }
+
+    return m_storage.heap->equal(v.m_storage.heap.get());
 }
 
 #ifndef NO_QT_SUPPORT
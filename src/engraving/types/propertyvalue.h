@@ -23,6 +23,9 @@
 
 #include <memory>
 #include <cassert>
+#include <cstring>
+#include <new>
+#include <type_traits>
 
 #ifndef NO_QT_SUPPORT
 #include <QVariant>
@@ -137,244 +140,285 @@ enum class P_TYPE : unsigned char {
     GROUPS,
 };
 
+//---------------------------------------------------------
+//   PropertyValue
+//    Small trivially copyable values (bool, int, real, Spatium,
+//    Fraction, PointF, Color, enums...) are stored inline, other
+//    ones (strings, vectors, paths...) in a shared heap object.
+//---------------------------------------------------------
+
 class PropertyValue
 {
 public:
-    PropertyValue() = default;
+    PropertyValue() { new (&m_storage.heap) std::shared_ptr<IArg>(); }
+
+    PropertyValue(const PropertyValue& other)
+        : m_type(other.m_type) { copyStorage(other); }
+
+    PropertyValue(PropertyValue&& other) noexcept
+        : m_type(other.m_type) { moveStorage(std::move(other)); }
+
+    ~PropertyValue() { destroyStorage(); }
+
+    PropertyValue& operator=(const PropertyValue& other)
+    {
+        if (this != &other) {
+            destroyStorage();
+            copyStorage(other);
+            m_type = other.m_type;
+        }
+        return *this;
+    }
+
+    PropertyValue& operator=(PropertyValue&& other) noexcept
+    {
+        if (this != &other) {
+            destroyStorage();
+            moveStorage(std::move(other));
+            m_type = other.m_type;
+        }
+        return *this;
+    }
 
     // Base
     PropertyValue(bool v)
-        : m_type(P_TYPE::BOOL), m_data(make_data<bool>(v)) {}
+        : m_type(P_TYPE::BOOL) { setData<bool>(v); }
 
     PropertyValue(int v)
-        : m_type(P_TYPE::INT), m_data(make_data<int>(v)) {}
+        : m_type(P_TYPE::INT) { setData<int>(v); }
 
     PropertyValue(const std::vector<int>& v)
-        : m_type(P_TYPE::INT_VEC), m_data(make_data<std::vector<int> >(v)) {}
+        : m_type(P_TYPE::INT_VEC) { setData<std::vector<int> >(v); }
 
     PropertyValue(size_t v)
-        : m_type(P_TYPE::SIZE_T), m_data(make_data<size_t>(v)) {}
+        : m_type(P_TYPE::SIZE_T) { setData<size_t>(v); }
 
     PropertyValue(double v)
-        : m_type(P_TYPE::REAL), m_data(make_data<double>(v)) {}
+        : m_type(P_TYPE::REAL) { setData<double>(v); }
 
     PropertyValue(const char* v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(String::fromUtf8(v))) {}
+        : m_type(P_TYPE::STRING) { setData<String>(String::fromUtf8(v)); }
 
     PropertyValue(const String& v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(v)) {}
+        : m_type(P_TYPE::STRING) { setData<String>(v); }
 
 #ifndef NO_QT_SUPPORT
     PropertyValue(const QString& v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(String::fromQString(v))) {}
+        : m_type(P_TYPE::STRING) { setData<String>(String::fromQString(v)); }
 #endif
 
     // Geometry
     PropertyValue(const PointF& v)
-        : m_type(P_TYPE::POINT), m_data(make_data<PointF>(v)) {}
+        : m_type(P_TYPE::POINT) { setData<PointF>(v); }
 
     PropertyValue(const PairF& v)
-        : m_type(P_TYPE::PAIR_REAL), m_data(make_data<PairF>(v)) {}
+        : m_type(P_TYPE::PAIR_REAL) { setData<PairF>(v); }
 
     PropertyValue(const SizeF& v)
-        : m_type(P_TYPE::SIZE), m_data(make_data<SizeF>(v)) {}
+        : m_type(P_TYPE::SIZE) { setData<SizeF>(v); }
 
     PropertyValue(const PainterPath& v)
-        : m_type(P_TYPE::DRAW_PATH), m_data(make_data<PainterPath>(v)) {}
+        : m_type(P_TYPE::DRAW_PATH) { setData<PainterPath>(v); }
 
     PropertyValue(const ScaleF& v)
-        : m_type(P_TYPE::SCALE), m_data(make_data<ScaleF>(v)) {}
+        : m_type(P_TYPE::SCALE) { setData<ScaleF>(v); }
 
     PropertyValue(const Spatium& v)
-        : m_type(P_TYPE::SPATIUM), m_data(make_data<Spatium>(v)) {}
+        : m_type(P_TYPE::SPATIUM) { setData<Spatium>(v); }
 
     // Draw
     PropertyValue(SymId v)
-        : m_type(P_TYPE::SYMID), m_data(make_data<SymId>(v)) {}
+        : m_type(P_TYPE::SYMID) { setData<SymId>(v); }
 
     PropertyValue(const Color& v)
-        : m_type(P_TYPE::COLOR), m_data(make_data<Color>(v)) {}
+        : m_type(P_TYPE::COLOR) { setData<Color>(v); }
 
     PropertyValue(OrnamentStyle v)
-        : m_type(P_TYPE::ORNAMENT_STYLE), m_data(make_data<OrnamentStyle>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_STYLE) { setData<OrnamentStyle>(v); }
 
     PropertyValue(GlissandoStyle v)
-        : m_type(P_TYPE::GLISS_STYLE), m_data(make_data<GlissandoStyle>(v)) {}
+        : m_type(P_TYPE::GLISS_STYLE) { setData<GlissandoStyle>(v); }
 
     PropertyValue(GlissandoType v)
-        : m_type(P_TYPE::GLISS_TYPE), m_data(make_data<GlissandoType>(v)) {}
+        : m_type(P_TYPE::GLISS_TYPE) { setData<GlissandoType>(v); }
 
     // Layout
     PropertyValue(Align v)
-        : m_type(P_TYPE::ALIGN), m_data(make_data<Align>(v)) {}
+        : m_type(P_TYPE::ALIGN) { setData<Align>(v); }
     PropertyValue(AlignH v)
-        : m_type(P_TYPE::ALIGN_H), m_data(make_data<AlignH>(v)) {}
+        : m_type(P_TYPE::ALIGN_H) { setData<AlignH>(v); }
 
     PropertyValue(PlacementV v)
-        : m_type(P_TYPE::PLACEMENT_V), m_data(make_data<PlacementV>(v)) {}
+        : m_type(P_TYPE::PLACEMENT_V) { setData<PlacementV>(v); }
     PropertyValue(PlacementH v)
-        : m_type(P_TYPE::PLACEMENT_H), m_data(make_data<PlacementH>(v)) {}
+        : m_type(P_TYPE::PLACEMENT_H) { setData<PlacementH>(v); }
 
     PropertyValue(TextPlace v)
-        : m_type(P_TYPE::TEXT_PLACE), m_data(make_data<TextPlace>(v)) {}
+        : m_type(P_TYPE::TEXT_PLACE) { setData<TextPlace>(v); }
 
     PropertyValue(DirectionV v)
-        : m_type(P_TYPE::DIRECTION_V), m_data(make_data<DirectionV>(v)) {}
+        : m_type(P_TYPE::DIRECTION_V) { setData<DirectionV>(v); }
     PropertyValue(DirectionH v)
-        : m_type(P_TYPE::DIRECTION_H), m_data(make_data<DirectionH>(v)) {}
+        : m_type(P_TYPE::DIRECTION_H) { setData<DirectionH>(v); }
 
     PropertyValue(Orientation v)
-        : m_type(P_TYPE::ORIENTATION), m_data(make_data<Orientation>(v)) {}
+        : m_type(P_TYPE::ORIENTATION) { setData<Orientation>(v); }
 
     PropertyValue(BeamMode v)
-        : m_type(P_TYPE::BEAM_MODE), m_data(make_data<BeamMode>(v)) {}
+        : m_type(P_TYPE::BEAM_MODE) { setData<BeamMode>(v); }
 
     PropertyValue(const AccidentalRole& v)
-        : m_type(P_TYPE::ACCIDENTAL_ROLE), m_data(make_data<AccidentalRole>(v)) {}
+        : m_type(P_TYPE::ACCIDENTAL_ROLE) { setData<AccidentalRole>(v); }
 
     PropertyValue(TiePlacement v)
-        : m_type(P_TYPE::TIE_PLACEMENT), m_data(make_data<TiePlacement>(v)) {}
+        : m_type(P_TYPE::TIE_PLACEMENT) { setData<TiePlacement>(v); }
 
     PropertyValue(TieDotsPlacement v)
-        : m_type(P_TYPE::TIE_DOTS_PLACEMENT), m_data(make_data<TieDotsPlacement>(v)) {}
+        : m_type(P_TYPE::TIE_DOTS_PLACEMENT) { setData<TieDotsPlacement>(v); }
 
     PropertyValue(TimeSigPlacement v)
-        : m_type(P_TYPE::TIMESIG_PLACEMENT), m_data(make_data<TimeSigPlacement>(v)) {}
+        : m_type(P_TYPE::TIMESIG_PLACEMENT) { setData<TimeSigPlacement>(v); }
 
     PropertyValue(TimeSigStyle v)
-        : m_type(P_TYPE::TIMESIG_STYLE), m_data(make_data<TimeSigStyle>(v)) {}
+        : m_type(P_TYPE::TIMESIG_STYLE) { setData<TimeSigStyle>(v); }
 
     PropertyValue(TimeSigVSMargin v)
-        : m_type(P_TYPE::TIMESIG_MARGIN), m_data(make_data<TimeSigVSMargin>(v)) {}
+        : m_type(P_TYPE::TIMESIG_MARGIN) { setData<TimeSigVSMargin>(v); }
 
     PropertyValue(NoteSpellingType v)
-        : m_type(P_TYPE::NOTE_SPELLING_TYPE), m_data(make_data<NoteSpellingType>(v)) {}
+        : m_type(P_TYPE::NOTE_SPELLING_TYPE) { setData<NoteSpellingType>(v); }
 
     PropertyValue(const ChordStylePreset& v)
-        : m_type(P_TYPE::CHORD_PRESET_TYPE), m_data(make_data<ChordStylePreset>(v)) {}
+        : m_type(P_TYPE::CHORD_PRESET_TYPE) { setData<ChordStylePreset>(v); }
 
     PropertyValue(const ParenthesesMode& v)
-        : m_type(P_TYPE::PARENTHESES_MODE), m_data(make_data<ParenthesesMode>(v)) {}
+        : m_type(P_TYPE::PARENTHESES_MODE) { setData<ParenthesesMode>(v); }
 
     PropertyValue(const RepeatPlayCountPreset& v)
-        : m_type(P_TYPE::PLAY_COUNT_PRESET), m_data(make_data<RepeatPlayCountPreset>(v)) {}
+        : m_type(P_TYPE::PLAY_COUNT_PRESET) { setData<RepeatPlayCountPreset>(v); }
 
     // Sound
     PropertyValue(const Fraction& v)
-        : m_type(P_TYPE::FRACTION), m_data(make_data<Fraction>(v)) {}
+        : m_type(P_TYPE::FRACTION) { setData<Fraction>(v); }
     PropertyValue(const DurationTypeWithDots& v)
-        : m_type(P_TYPE::DURATION_TYPE_WITH_DOTS), m_data(make_data<DurationTypeWithDots>(v)) {}
+        : m_type(P_TYPE::DURATION_TYPE_WITH_DOTS) { setData<DurationTypeWithDots>(v); }
     PropertyValue(ChangeMethod v)
-        : m_type(P_TYPE::CHANGE_METHOD), m_data(make_data<ChangeMethod>(v)) {}
+        : m_type(P_TYPE::CHANGE_METHOD) { setData<ChangeMethod>(v); }
     PropertyValue(const PitchValues& v)
-        : m_type(P_TYPE::PITCH_VALUES), m_data(make_data<PitchValues>(v)) {}
+        : m_type(P_TYPE::PITCH_VALUES) { setData<PitchValues>(v); }
     PropertyValue(const BeatsPerSecond& v)
-        : m_type(P_TYPE::TEMPO), m_data(make_data<BeatsPerSecond>(v)) {}
+        : m_type(P_TYPE::TEMPO) { setData<BeatsPerSecond>(v); }
 
     // Types
     PropertyValue(LayoutBreakType v)
-        : m_type(P_TYPE::LAYOUTBREAK_TYPE), m_data(make_data<LayoutBreakType>(v)) {}
+        : m_type(P_TYPE::LAYOUTBREAK_TYPE) { setData<LayoutBreakType>(v); }
 
     PropertyValue(VeloType v)
-        : m_type(P_TYPE::VELO_TYPE), m_data(make_data<VeloType>(v)) {}
+        : m_type(P_TYPE::VELO_TYPE) { setData<VeloType>(v); }
 
     PropertyValue(BarLineType v)
-        : m_type(P_TYPE::BARLINE_TYPE), m_data(make_data<BarLineType>(v)) {}
+        : m_type(P_TYPE::BARLINE_TYPE) { setData<BarLineType>(v); }
 
     PropertyValue(NoteHeadType v)
-        : m_type(P_TYPE::NOTEHEAD_TYPE), m_data(make_data<NoteHeadType>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_TYPE) { setData<NoteHeadType>(v); }
     PropertyValue(NoteHeadScheme v)
-        : m_type(P_TYPE::NOTEHEAD_SCHEME), m_data(make_data<NoteHeadScheme>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_SCHEME) { setData<NoteHeadScheme>(v); }
     PropertyValue(NoteHeadGroup v)
-        : m_type(P_TYPE::NOTEHEAD_GROUP), m_data(make_data<NoteHeadGroup>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_GROUP) { setData<NoteHeadGroup>(v); }
 
     PropertyValue(ClefType v)
-        : m_type(P_TYPE::CLEF_TYPE), m_data(make_data<ClefType>(v)) {}
+        : m_type(P_TYPE::CLEF_TYPE) { setData<ClefType>(v); }
 
     PropertyValue(ClefToBarlinePosition v)
-        : m_type(P_TYPE::CLEF_TO_BARLINE_POS), m_data(make_data<ClefToBarlinePosition>(v)) {}
+        : m_type(P_TYPE::CLEF_TO_BARLINE_POS) { setData<ClefToBarlinePosition>(v); }
 
     PropertyValue(DynamicType v)
-        : m_type(P_TYPE::DYNAMIC_TYPE), m_data(make_data<DynamicType>(v)) {}
+        : m_type(P_TYPE::DYNAMIC_TYPE) { setData<DynamicType>(v); }
     PropertyValue(DynamicSpeed v)
-        : m_type(P_TYPE::DYNAMIC_SPEED), m_data(make_data<DynamicSpeed>(v)) {}
+        : m_type(P_TYPE::DYNAMIC_SPEED) { setData<DynamicSpeed>(v); }
 
     PropertyValue(LineType v)
-        : m_type(P_TYPE::LINE_TYPE), m_data(make_data<LineType>(v)) {}
+        : m_type(P_TYPE::LINE_TYPE) { setData<LineType>(v); }
     PropertyValue(HookType v)
-        : m_type(P_TYPE::HOOK_TYPE), m_data(make_data<HookType>(v)) {}
+        : m_type(P_TYPE::HOOK_TYPE) { setData<HookType>(v); }
 
     PropertyValue(KeyMode v)
-        : m_type(P_TYPE::KEY_MODE), m_data(make_data<KeyMode>(v)) {}
+        : m_type(P_TYPE::KEY_MODE) { setData<KeyMode>(v); }
 
     PropertyValue(TextStyleType v)
-        : m_type(P_TYPE::TEXT_STYLE), m_data(make_data<TextStyleType>(v)) {}
+        : m_type(P_TYPE::TEXT_STYLE) { setData<TextStyleType>(v); }
 
     PropertyValue(PlayingTechniqueType v)
-        : m_type(P_TYPE::PLAYTECH_TYPE), m_data(make_data<PlayingTechniqueType>(v)) {}
+        : m_type(P_TYPE::PLAYTECH_TYPE) { setData<PlayingTechniqueType>(v); }
 
     PropertyValue(GradualTempoChangeType v)
-        : m_type(P_TYPE::TEMPOCHANGE_TYPE), m_data(make_data<GradualTempoChangeType>(v)) {}
+        : m_type(P_TYPE::TEMPOCHANGE_TYPE) { setData<GradualTempoChangeType>(v); }
 
     PropertyValue(SlurStyleType v)
-        : m_type(P_TYPE::SLUR_STYLE_TYPE), m_data(make_data<SlurStyleType>(v)) {}
+        : m_type(P_TYPE::SLUR_STYLE_TYPE) { setData<SlurStyleType>(v); }
 
     PropertyValue(const NoteLineEndPlacement& v)
-        : m_type(P_TYPE::NOTELINE_PLACEMENT_TYPE), m_data(make_data<NoteLineEndPlacement>(v)) {}
+        : m_type(P_TYPE::NOTELINE_PLACEMENT_TYPE) { setData<NoteLineEndPlacement>(v); }
 
     // Other
     PropertyValue(const GroupNodes& v)
-        : m_type(P_TYPE::GROUPS), m_data(make_data<GroupNodes>(v)) {}
+        : m_type(P_TYPE::GROUPS) { setData<GroupNodes>(v); }
 
     PropertyValue(const OrnamentInterval& v)
-        : m_type(P_TYPE::ORNAMENT_INTERVAL), m_data(make_data<OrnamentInterval>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_INTERVAL) { setData<OrnamentInterval>(v); }
 
     PropertyValue(const OrnamentShowAccidental& v)
-        : m_type(P_TYPE::ORNAMENT_SHOW_ACCIDENTAL), m_data(make_data<OrnamentShowAccidental>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_SHOW_ACCIDENTAL) { setData<OrnamentShowAccidental>(v); }
 
     PropertyValue(const LyricsDashSystemStart& v)
-        : m_type(P_TYPE::LYRICS_DASH_SYSTEM_START_TYPE), m_data(make_data<LyricsDashSystemStart>(v)) {}
+        : m_type(P_TYPE::LYRICS_DASH_SYSTEM_START_TYPE) { setData<LyricsDashSystemStart>(v); }
 
     PropertyValue(const PartialSpannerDirection& v)
-        : m_type(P_TYPE::PARTIAL_SPANNER_DIRECTION), m_data(make_data<PartialSpannerDirection>(v)) {}
+        : m_type(P_TYPE::PARTIAL_SPANNER_DIRECTION) { setData<PartialSpannerDirection>(v); }
 
     PropertyValue(const LHTappingSymbol& v)
-        : m_type(P_TYPE::LH_TAPPING_SYMBOL), m_data(make_data<LHTappingSymbol>(v)) {}
+        : m_type(P_TYPE::LH_TAPPING_SYMBOL) { setData<LHTappingSymbol>(v); }
 
     PropertyValue(const RHTappingSymbol& v)
-        : m_type(P_TYPE::RH_TAPPING_SYMBOL), m_data(make_data<RHTappingSymbol>(v)) {}
+        : m_type(P_TYPE::RH_TAPPING_SYMBOL) { setData<RHTappingSymbol>(v); }
 
     PropertyValue(const VibratoType& v)
-        : m_type(P_TYPE::VIBRATO_LINE_TYPE), m_data(make_data<VibratoType>(v)) {}
+        : m_type(P_TYPE::VIBRATO_LINE_TYPE) { setData<VibratoType>(v); }
 
     PropertyValue(const VoiceAssignment& v)
-        : m_type(P_TYPE::VOICE_ASSIGNMENT), m_data(make_data<VoiceAssignment>(v)) {}
+        : m_type(P_TYPE::VOICE_ASSIGNMENT) { setData<VoiceAssignment>(v); }
 
     PropertyValue(const AutoOnOff& v)
-        : m_type(P_TYPE::AUTO_ON_OFF), m_data(make_data<AutoOnOff>(v)) {}
+        : m_type(P_TYPE::AUTO_ON_OFF) { setData<AutoOnOff>(v); }
 
     PropertyValue(const AutoCustomHide& v)
-        : m_type(P_TYPE::AUTO_CUSTOM_HIDE), m_data(make_data<AutoCustomHide>(v)) {}
+        : m_type(P_TYPE::AUTO_CUSTOM_HIDE) { setData<AutoCustomHide>(v); }
 
     PropertyValue(const MarkerType& v)
-        : m_type(P_TYPE::MARKER_TYPE), m_data(make_data<MarkerType>(v)) {}
+        : m_type(P_TYPE::MARKER_TYPE) { setData<MarkerType>(v); }
 
     PropertyValue(const MeasureNumberPlacement& v)
-        : m_type(P_TYPE::MEASURE_NUMBER_PLACEMENT), m_data(make_data<MeasureNumberPlacement>(v)) {}
+        : m_type(P_TYPE::MEASURE_NUMBER_PLACEMENT) { setData<MeasureNumberPlacement>(v); }
 
     PropertyValue(const CapoParams::TransposeMode& v)
-        : m_type(P_TYPE::CAPO_TRANSPOSE_MODE), m_data(make_data<CapoParams::TransposeMode>(v)) {}
+        : m_type(P_TYPE::CAPO_TRANSPOSE_MODE) { setData<CapoParams::TransposeMode>(v); }
 
     PropertyValue(const InstrumentNamesAlign& v)
-        : m_type(P_TYPE::INSTRUMENT_NAMES_ALIGN), m_data(make_data<InstrumentNamesAlign>(v)) {}
+        : m_type(P_TYPE::INSTRUMENT_NAMES_ALIGN) { setData<InstrumentNamesAlign>(v); }
 
     PropertyValue(const InstrumentNamesFormat& v)
-        : m_type(P_TYPE::INSTRUMENT_NAMES_FORMAT), m_data(make_data<InstrumentNamesFormat>(v)) {}
+        : m_type(P_TYPE::INSTRUMENT_NAMES_FORMAT) { setData<InstrumentNamesFormat>(v); }
 
     bool isValid() const;
 
     P_TYPE type() const;
-    bool isEnum() const { return m_data ? m_data->isEnum() : false; }
+    bool isEnum() const
+    {
+        if (m_inlineOps) {
+            return m_inlineOps->isEnum;
+        }
+        return m_storage.heap ? m_storage.heap->isEnum() : false;
+    }
 
     template<typename T>
     T value() const
@@ -383,12 +427,12 @@ public:
             return T();
         }
 
-        assert(m_data);
-        if (!m_data) {
+        assert(hasData());
+        if (!hasData()) {
             return T();
         }
 
-        Arg<T>* at = get<T>();
+        const T* at = get<T>();
         if (!at) {
             //! HACK Temporary hack for int to enum
             if constexpr (std::is_enum<T>::value) {
@@ -399,8 +443,8 @@ public:
 
             //! HACK Temporary hack for enum to int
             if constexpr (std::is_same<T, int>::value) {
-                if (m_data->isEnum()) {
-                    return m_data->enumToInt();
+                if (isEnum()) {
+                    return enumToInt();
                 }
             }
 
@@ -426,9 +470,9 @@ public:
             //! HACK Temporary hack for real to Spatium
             if constexpr (std::is_same<T, Spatium>::value) {
                 if (P_TYPE::REAL == m_type) {
-                    Arg<double>* srv = get<double>();
+                    const double* srv = get<double>();
                     assert(srv);
-                    return srv ? Spatium(srv->v) : Spatium();
+                    return srv ? Spatium(*srv) : Spatium();
                 }
             }
 
@@ -472,7 +516,7 @@ public:
         if (!at) {
             return T();
         }
-        return at->v;
+        return *at;
     }
 
     bool toBool() const { return value<bool>(); }
@@ -532,20 +576,117 @@ private:
         }
     };
 
+    static constexpr size_t INLINE_CAPACITY = 16;
+
+    template<typename T>
+    static constexpr bool isInline()
+    {
+        return std::is_trivially_copyable<T>::value && sizeof(T) <= INLINE_CAPACITY && alignof(T) <= alignof(double);
+    }
+
+    struct InlineOps {
+        bool (*equal)(const void* a, const void* b);
+        int (*enumToInt)(const void* v);
+        bool isEnum;
+    };
+
+    template<typename T>
+    struct InlineArg {
+        static bool equal(const void* a, const void* b)
+        {
+            return *static_cast<const T*>(a) == *static_cast<const T*>(b);
+        }
+
+        //! HACK Temporary hack for enum to int
+        static int enumToInt(const void* v)
+        {
+            if constexpr (std::is_enum<T>::value) {
+                return static_cast<int>(*static_cast<const T*>(v));
+            } else {
+                return -1;
+            }
+        }
+
+        static constexpr InlineOps OPS = { &InlineArg<T>::equal, &InlineArg<T>::enumToInt, std::is_enum<T>::value };
+    };
+
+    union Storage {
+        alignas(double) unsigned char bytes[INLINE_CAPACITY];
+        std::shared_ptr<IArg> heap;
+
+        Storage() {}
+        ~Storage() {}
+    };
+
+    // must only be called from constructors
     template<typename T>
-    inline std::shared_ptr<IArg> make_data(const T& v) const
+    inline void setData(const T& v)
     {
-        return std::shared_ptr<IArg>(new Arg<T>(v));
+        if constexpr (isInline<T>()) {
+            new (m_storage.bytes) T(v);
+            m_inlineOps = &InlineArg<T>::OPS;
+        } else {
+            new (&m_storage.heap) std::shared_ptr<IArg>(new Arg<T>(v));
+        }
     }
 
     template<typename T>
-    inline Arg<T>* get() const
+    inline const T* get() const
+    {
+        if constexpr (isInline<T>()) {
+            if (m_inlineOps != &InlineArg<T>::OPS) {
+                return nullptr;
+            }
+            return std::launder(reinterpret_cast<const T*>(m_storage.bytes));
+        } else {
+            if (m_inlineOps) {
+                return nullptr;
+            }
+            const Arg<T>* at = dynamic_cast<const Arg<T>*>(m_storage.heap.get());
+            return at ? &at->v : nullptr;
+        }
+    }
+
+    bool hasData() const { return m_inlineOps || m_storage.heap; }
+
+    int enumToInt() const
+    {
+        if (m_inlineOps) {
+            return m_inlineOps->enumToInt(m_storage.bytes);
+        }
+        return m_storage.heap ? m_storage.heap->enumToInt() : -1;
+    }
+
+    void copyStorage(const PropertyValue& other)
     {
-        return dynamic_cast<Arg<T>*>(m_data.get());
+        m_inlineOps = other.m_inlineOps;
+        if (m_inlineOps) {
+            std::memcpy(m_storage.bytes, other.m_storage.bytes, INLINE_CAPACITY);
+        } else {
+            new (&m_storage.heap) std::shared_ptr<IArg>(other.m_storage.heap);
+        }
+    }
+
+    void moveStorage(PropertyValue&& other)
+    {
+        m_inlineOps = other.m_inlineOps;
+        if (m_inlineOps) {
+            std::memcpy(m_storage.bytes, other.m_storage.bytes, INLINE_CAPACITY);
+        } else {
+            new (&m_storage.heap) std::shared_ptr<IArg>(std::move(other.m_storage.heap));
+        }
+    }
+
+    void destroyStorage()
+    {
+        if (!m_inlineOps) {
+            std::destroy_at(&m_storage.heap);
+        }
     }
 
     P_TYPE m_type = P_TYPE::UNDEFINED;
-    std::shared_ptr<IArg> m_data = nullptr;
+    const InlineOps* m_inlineOps = nullptr;     // not null if the value is stored inline
+    Storage m_storage;
 };
 }
 
@@ -50,9 +50,9 @@ void ImagesExportModule::resolveImports()
 {
     auto writers = globalIoc()->resolve<INotationWritersRegister>(moduleName());
     if (writers) {
-        writers->reg({ "pdf" }, std::make_shared<PdfWriter>());
-        writers->reg({ "svg" }, std::make_shared<SvgWriter>());
-        writers->reg({ "png" }, std::make_shared<PngWriter>());
+        writers->reg({ "pdf" }, []() { return std::make_shared<PdfWriter>(); });
+        writers->reg({ "svg" }, []() { return std::make_shared<SvgWriter>(); });
+        writers->reg({ "png" }, []() { return std::make_shared<PngWriter>(); });
     }
 }
 
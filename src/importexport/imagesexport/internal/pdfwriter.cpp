@@ -23,7 +23,7 @@
 #include "pdfwriter.h"
 
 #include <QPdfWriter>
-#include <QBuffer>
+#include <QIODevice>
 
 #include "engraving/dom/masterscore.h"
 
@@ -37,6 +37,71 @@ using namespace muse::io;
 using namespace muse::draw;
 using namespace mu::engraving;
 
+//! NOTE By default the whole document is collected in memory and written to the destination
+//! device at once, so the device never holds a partial document (e.g. a Buffer that is read
+//! back while the export fails). With OptionKey::STREAM_TO_DEVICE the PDF data is passed to the
+//! device while the pages are painted, and QPdfWriter only keeps the page being painted
+//! (and the resources used so far) in memory. The caller then has to deal with partial output.
+namespace {
+class DestinationDeviceStream : public QIODevice
+{
+public:
+    DestinationDeviceStream(IODevice& device, bool streaming)
+        : m_device(device), m_streaming(streaming) {}
+
+    bool isSequential() const override { return true; }
+
+    //! NOTE QPdfWriter ignores the write errors of its device, so they are checked after painting
+    Ret finish()
+    {
+        if (!m_streaming && !m_failed) {
+            ByteArray data = ByteArray::fromQByteArrayNoCopy(m_buffer);
+            m_failed = m_device.write(data) != data.size();
+        }
+
+        if (m_failed || m_device.hasError()) {
+            return make_ret(Ret::Code::UnknownError, m_device.errorString());
+        }
+
+        return make_ret(Ret::Code::Ok);
+    }
+
+protected:
+    qint64 readData(char*, qint64) override
+    {
+        return -1;
+    }
+
+    qint64 writeData(const char* data, qint64 len) override
+    {
+        if (m_failed) {
+            return -1;
+        }
+
+        if (!m_streaming) {
+            m_buffer.append(data, len);
+            return len;
+        }
+
+        size_t written = m_device.write(reinterpret_cast<const uint8_t*>(data), static_cast<size_t>(len));
+        if (written != static_cast<size_t>(len)) {
+            LOGE() << "failed write to destination device, err: " << m_device.errorString();
+            setErrorString(QString::fromStdString(m_device.errorString()));
+            m_failed = true;
+            return -1;
+        }
+
+        return len;
+    }
+
+private:
+    IODevice& m_device;
+    bool m_streaming = false;
+    QByteArray m_buffer;
+    bool m_failed = false;
+};
+}
+
 std::vector<INotationWriter::UnitType> PdfWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PART, UnitType::MULTI_PART };
@@ -53,11 +118,10 @@ Ret PdfWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
         return make_ret(Ret::Code::UnknownError);
     }
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
+    DestinationDeviceStream stream(destinationDevice, muse::value(options, OptionKey::STREAM_TO_DEVICE, Val(false)).toBool());
+    stream.open(QIODevice::WriteOnly);
 
-    QPdfWriter pdfWriter(&buf);
+    QPdfWriter pdfWriter(&stream);
     preparePdfWriter(pdfWriter, notation->projectWorkTitleAndPartName(), notation->painting()->pageSizeInch().toQSizeF());
 
     Painter painter(&pdfWriter, "pdfwriter");
@@ -83,10 +147,7 @@ Ret PdfWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
 
     painter.endDraw();
 
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
-
-    return true;
+    return stream.finish();
 }
 
 Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destinationDevice, const Options& options)
@@ -105,11 +166,10 @@ Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destin
         return make_ret(Ret::Code::UnknownError);
     }
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
+    DestinationDeviceStream stream(destinationDevice, muse::value(options, OptionKey::STREAM_TO_DEVICE, Val(false)).toBool());
+    stream.open(QIODevice::WriteOnly);
 
-    QPdfWriter pdfWriter(&buf);
+    QPdfWriter pdfWriter(&stream);
     preparePdfWriter(pdfWriter, firstNotation->projectWorkTitle(), firstNotation->painting()->pageSizeInch().toQSizeF());
 
     Painter painter(&pdfWriter, "pdfwriter");
@@ -141,10 +201,7 @@ Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destin
 
     painter.endDraw();
 
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
-
-    return true;
+    return stream.finish();
 }
 
 void PdfWriter::preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const
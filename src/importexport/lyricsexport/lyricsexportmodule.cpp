@@ -48,7 +48,7 @@ void LyricsExportModule::resolveImports()
 {
     auto writers = globalIoc()->resolve<INotationWritersRegister>(moduleName());
     if (writers) {
-        writers->reg({ "lrc" }, std::make_shared<LRCWriter>(muse::modularity::globalCtx()));
+        writers->reg({ "lrc" }, []() { return std::make_shared<LRCWriter>(muse::modularity::globalCtx()); });
     }
 }
 
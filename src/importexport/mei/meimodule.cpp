@@ -56,7 +56,7 @@ void MeiModule::resolveImports()
 
     auto writers = globalIoc()->resolve<INotationWritersRegister>(moduleName());
     if (writers) {
-        writers->reg({ "mei" }, std::make_shared<MeiWriter>());
+        writers->reg({ "mei" }, []() { return std::make_shared<MeiWriter>(); });
     }
 }
 
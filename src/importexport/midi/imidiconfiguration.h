@@ -45,6 +45,15 @@ public:
     virtual void setRoundTempo(bool round) = 0;
     virtual muse::async::Channel<bool> roundTempoChanged() const = 0;
 
+    virtual int tupletSearchNodeLimit() const = 0; // per bar, 0 - unlimited
+    virtual void setTupletSearchNodeLimit(int nodes) = 0;
+
+    virtual int tupletSearchTimeLimit() const = 0; // ms per bar, 0 - unlimited; import results depend on the machine if set
+    virtual void setTupletSearchTimeLimit(int ms) = 0;
+
+    virtual bool isParallelImport() const = 0;
+    virtual void setIsParallelImport(bool parallel) = 0;
+
     virtual void setMidiImportOperationsFile(const std::optional<muse::io::path_t>& filePath) const = 0;
 
     // export
@@ -35,6 +35,9 @@ static const Settings::Key SHORTEST_NOTE_KEY("iex_midi", "io/midi/shortestNote")
 static const Settings::Key EXPORTRPNS_KEY("iex_midi", "io/midi/exportRPNs");
 static const Settings::Key EXPAND_REPEATS_KEY("iex_midi", "io/midi/expandRepeats");
 static const Settings::Key ROUND_TEMPO_KEY("iex_midi", "io/midi/roundTempo");
+static const Settings::Key TUPLET_SEARCH_NODE_LIMIT_KEY("iex_midi", "io/midi/tupletSearchNodeLimit");
+static const Settings::Key TUPLET_SEARCH_TIME_LIMIT_KEY("iex_midi", "io/midi/tupletSearchTimeLimit");
+static const Settings::Key PARALLEL_IMPORT_KEY("iex_midi", "io/midi/parallelImport");
 
 void MidiConfiguration::init()
 {
@@ -48,6 +51,10 @@ void MidiConfiguration::init()
         m_roundTempoChanged.send(val.toBool());
     });
 
+    settings()->setDefaultValue(TUPLET_SEARCH_NODE_LIMIT_KEY, Val(200000));
+    settings()->setDefaultValue(TUPLET_SEARCH_TIME_LIMIT_KEY, Val(0));
+    settings()->setDefaultValue(PARALLEL_IMPORT_KEY, Val(false));
+
     settings()->setDefaultValue(EXPAND_REPEATS_KEY, Val(true));
     settings()->setDefaultValue(EXPORTRPNS_KEY, Val(true));
 }
@@ -82,6 +89,36 @@ async::Channel<bool> MidiConfiguration::roundTempoChanged() const
     return m_roundTempoChanged;
 }
 
+int MidiConfiguration::tupletSearchNodeLimit() const
+{
+    return settings()->value(TUPLET_SEARCH_NODE_LIMIT_KEY).toInt();
+}
+
+void MidiConfiguration::setTupletSearchNodeLimit(int nodes)
+{
+    settings()->setSharedValue(TUPLET_SEARCH_NODE_LIMIT_KEY, Val(nodes));
+}
+
+int MidiConfiguration::tupletSearchTimeLimit() const
+{
+    return settings()->value(TUPLET_SEARCH_TIME_LIMIT_KEY).toInt();
+}
+
+void MidiConfiguration::setTupletSearchTimeLimit(int ms)
+{
+    settings()->setSharedValue(TUPLET_SEARCH_TIME_LIMIT_KEY, Val(ms));
+}
+
+bool MidiConfiguration::isParallelImport() const
+{
+    return settings()->value(PARALLEL_IMPORT_KEY).toBool();
+}
+
+void MidiConfiguration::setIsParallelImport(bool parallel)
+{
+    settings()->setSharedValue(PARALLEL_IMPORT_KEY, Val(parallel));
+}
+
 void MidiConfiguration::setMidiImportOperationsFile(const std::optional<muse::io::path_t>& filePath) const
 {
     if (filePath) {
@@ -41,6 +41,15 @@ public:
     void setRoundTempo(bool round) override;
     muse::async::Channel<bool> roundTempoChanged() const override;
 
+    int tupletSearchNodeLimit() const override;
+    void setTupletSearchNodeLimit(int nodes) override;
+
+    int tupletSearchTimeLimit() const override; // ms
+    void setTupletSearchTimeLimit(int ms) override;
+
+    bool isParallelImport() const override;
+    void setIsParallelImport(bool parallel) override;
+
     void setMidiImportOperationsFile(const std::optional<muse::io::path_t>& filePath) const override;
 
     // export
@@ -295,8 +295,8 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
                 }
 
                 for (size_t e = 0; e < events.size(); ++e) {
-                    auto& multimap = events[e];
-                    for (auto& item : multimap) {
+                    const ChannelEvents& channelEvents = events[e];
+                    for (const auto& item : channelEvents) {
                         const NPlayEvent& event = item.second;
                         if (event.isMuted()) {
                             continue;
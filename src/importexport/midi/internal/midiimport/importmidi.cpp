@@ -234,23 +234,30 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
 {
     auto& opers = midiImportOperations;
 
-    for (auto& track: tracks) {
-        MTrack& mtrack = track.second;
+    if (opers.data()->processingsOfOpenedFile == 0) {
+        for (const auto& track: tracks) {
+            const MTrack& mtrack = track.second;
+            if (mtrack.chords.empty()) {
+                continue;
+            }
+            opers.data()->trackOpers.isDrumTrack.setValue(
+                mtrack.indexOfOperation, mtrack.mtrack->drumTrack());
+            if (mtrack.mtrack->drumTrack()) {
+                opers.data()->trackOpers.maxVoiceCount.setValue(
+                    mtrack.indexOfOperation, MidiOperations::VoiceCount::V_1);
+            }
+        }
+    }
+
+    // operations are only read from now, so tracks can be quantized independently
+    forEachTrack(tracks, [&opers, sigmap, &lastTick](MTrack& mtrack) {
         if (mtrack.chords.empty()) {
-            continue;
+            return;
         }
         // pass current track index through MidiImportOperations
         // for further usage
         MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
 
-        if (opers.data()->processingsOfOpenedFile == 0) {
-            opers.data()->trackOpers.isDrumTrack.setValue(
-                opers.currentTrack(), mtrack.mtrack->drumTrack());
-            if (mtrack.mtrack->drumTrack()) {
-                opers.data()->trackOpers.maxVoiceCount.setValue(
-                    opers.currentTrack(), MidiOperations::VoiceCount::V_1);
-            }
-        }
         const auto basicQuant = Quantize::quantValueToFraction(
             opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
 #ifdef QT_DEBUG
@@ -265,7 +272,7 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
             MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
         }
 #ifdef QT_DEBUG
-        Q_ASSERT_X(!doNotesOverlap(track.second),
+        Q_ASSERT_X(!doNotesOverlap(mtrack),
                    "quantizeAllTracks",
                    "There are overlapping notes of the same voice that is incorrect");
 #endif
@@ -279,7 +286,7 @@ void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
                    "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
                                         "or non-tuplet chord/note is inside tuplet");
 #endif
-    }
+    });
 }
 
 //---------------------------------------------------------
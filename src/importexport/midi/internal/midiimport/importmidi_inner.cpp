@@ -23,6 +23,15 @@
 
 #include <QTextCodec>
 
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include "engraving/infrastructure/parallelfor.h"
+#endif
+
+#include "modularity/ioc.h"
+#include "importexport/midi/imidiconfiguration.h"
+
 #include "importmidi_operations.h"
 #include "importmidi_chord.h"
 
@@ -99,6 +108,34 @@ void MTrack::updateTuplet(
     }
 }
 
+bool isParallelImportFromPreferences()
+{
+    auto conf = muse::modularity::globalIoc()->resolve<IMidiImportExportConfiguration>("iex_midi");
+    return conf ? conf->isParallelImport() : false;
+}
+
+void forEachTrack(std::multimap<int, MTrack>& tracks, const std::function<void(MTrack&)>& func)
+{
+#ifdef MUSE_THREADS_SUPPORT
+    if (tracks.size() > 1 && midiImportOperations.data()->trackOpers.isParallelImport.value()) {
+        std::vector<MTrack*> trackList;
+        for (auto& track: tracks) {
+            trackList.push_back(&track.second);
+        }
+
+        // current MIDI file is shared by all threads, current track is set per thread
+        engraving::parallelFor(trackList.size(), [&func, &trackList](size_t i) {
+            func(*trackList[i]);
+        });
+        return;
+    }
+#endif
+
+    for (auto& track: tracks) {
+        func(track.second);
+    }
+}
+
 namespace Meter {
 ReducedFraction userTimeSigToFraction(
     MidiOperations::TimeSigNumerator timeSigNumerator,
@@ -21,6 +21,8 @@
  */
 #pragma once
 
+#include <functional>
+#include <map>
 #include <vector>
 #include <utility>
 
@@ -126,6 +128,12 @@ private:
     void updateTuplet(std::multimap<ReducedFraction, MidiTuplet::TupletData>::iterator&);
 };
 
+// calls func for each track, on worker threads if parallel import is enabled;
+// func may change only the track it is called for and must not change the score.
+// The result is the same as of the serial loop unless the tuplet search time limit is set:
+// then the stop of the search depends on the load of the threads
+void forEachTrack(std::multimap<int, MTrack>& tracks, const std::function<void(MTrack&)>& func);
+
 namespace MidiTuplet {
 struct TupletInfo
 {
@@ -39,6 +39,11 @@ QString defaultCharset();
 namespace Quantize {
 MidiOperations::QuantValue defaultQuantValueFromPreferences();
 }
+namespace MidiTuplet {
+int tupletSearchNodeLimitFromPreferences();
+int tupletSearchTimeLimitFromPreferences();
+}
+bool isParallelImportFromPreferences();
 
 namespace MidiOperations {
 // operation types are in importmidi_operation.h
@@ -172,6 +177,11 @@ struct Opers
         = TrackOp<std::vector<const engraving::InstrumentTemplate*> >(
               std::vector<const engraving::InstrumentTemplate*>());
     TrackOp<bool> isDrumTrack = TrackOp<bool>(false);
+    // limits of the tuplet search in one bar, read here to be available for all import threads
+    Op<int> tupletSearchNodeLimit = Op<int>(MidiTuplet::tupletSearchNodeLimitFromPreferences());
+    Op<int> tupletSearchTimeLimit = Op<int>(MidiTuplet::tupletSearchTimeLimitFromPreferences());
+    // analyse tracks on worker threads
+    Op<bool> isParallelImport = Op<bool>(isParallelImportFromPreferences());
 
     // operations for all tracks
     Op<bool> isHumanPerformance = Op<bool>(false);
@@ -260,7 +270,8 @@ private:
 
     QString _currentMidiFile;
     QString _midiOperationsFile;
-    int _currentTrack = -1;
+    // tracks can be processed in parallel, each thread has its own current track
+    static thread_local int _currentTrack;
 
     std::map<QString, FileData> _data;      // <file name, tracks data>
 };
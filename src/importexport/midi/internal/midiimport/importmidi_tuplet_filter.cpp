@@ -25,9 +25,17 @@
 #include "importmidi_chord.h"
 #include "importmidi_quant.h"
 #include "importmidi_inner.h"
+#include "importmidi_operations.h"
 #include "engraving/dom/mscore.h"
 
+#include <chrono>
 #include <set>
+#include <utility>
+
+#include "modularity/ioc.h"
+#include "importexport/midi/imidiconfiguration.h"
+
+#include "log.h"
 
 namespace mu::iex::midi {
 namespace MidiTuplet {
@@ -53,6 +61,20 @@ public:
 
     bool isInitialized() const { return tupletCount != 0; }
 
+    // true if no result with at least the given average error and length of rests
+    // and with at most the given relative used chord places is less than this one
+    bool cannotBeImprovedBy(double minTupletAverageError,
+                            double maxRelativeUsedChordPlaces,
+                            double minSumLengthOfRests) const
+    {
+        // div() is monotonic in its first argument, tolerance covers rounding errors
+        const double minValue = div(minTupletAverageError, tupletAverageError)
+                                - div(maxRelativeUsedChordPlaces, relativeUsedChordPlaces)
+                                + div(minSumLengthOfRests,
+                                      sumLengthOfRests.numerator() * 1.0 / sumLengthOfRests.denominator());
+        return minValue > 1e-9;
+    }
+
     bool operator<(const TupletErrorResult& er) const
     {
         double value = div(tupletAverageError, er.tupletAverageError)
@@ -235,81 +257,6 @@ std::vector<TupletCommon> findTupletCommons(const std::vector<TupletInfo>& tuple
     return tupletCommons;
 }
 
-bool isInCommonIndexes(
-    int indexToCheck,
-    const std::vector<int>& selectedTuplets,
-    const std::vector<TupletCommon>& tupletCommons)
-{
-    for (size_t i = 0; i != selectedTuplets.size(); ++i) {
-        const int tupletIndex = selectedTuplets[i];
-
-        Q_ASSERT_X(indexToCheck != tupletIndex, "MidiTuplet::isInCommonIndexes",
-                   "Checked indexes are the same but they should be different");
-
-        if (indexToCheck > tupletIndex) {
-            const auto& indexes = tupletCommons[tupletIndex].commonIndexes;
-            if (indexes.find(indexToCheck) != indexes.end()) {
-                return true;
-            }
-        } else {
-            const auto& indexes = tupletCommons[indexToCheck].commonIndexes;
-            if (indexes.find(tupletIndex) != indexes.end()) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-TupletErrorResult findTupletError(
-    const std::vector<int>& tupletIndexes,
-    const std::vector<TupletInfo>& tuplets,
-    size_t voiceCount,
-    const ReducedFraction& basicQuant)
-{
-    ReducedFraction sumError{ 0, 1 };
-    ReducedFraction sumLengthOfRests{ 0, 1 };
-    size_t sumChordCount = 0;
-    int sumChordPlaces = 0;
-    std::set<std::pair<const ReducedFraction, MidiChord>*> usedChords;
-    std::vector<char> usedIndexes(tuplets.size(), 0);
-
-    for (int i: tupletIndexes) {
-        const auto& tuplet = tuplets[i];
-
-        sumError += tuplet.tupletSumError;
-        sumLengthOfRests += tuplet.sumLengthOfRests;
-        sumChordCount += tuplet.chords.size();
-        sumChordPlaces += tuplet.tupletNumber;
-
-        usedIndexes[i] = 1;
-        for (const auto& chord: tuplet.chords) {
-            usedChords.insert(&*chord.second);
-        }
-    }
-    // add quant error of all chords excluded from tuplets
-    for (size_t i = 0; i != tuplets.size(); ++i) {
-        if (usedIndexes[i]) {
-            continue;
-        }
-        const auto& tuplet = tuplets[i];
-        for (const auto& chord: tuplet.chords) {
-            if (usedChords.find(&*chord.second) != usedChords.end()) {
-                continue;
-            }
-            sumError += Quantize::findOnTimeQuantError(*chord.second, basicQuant);
-        }
-    }
-
-    return TupletErrorResult{
-        sumError.numerator() * 1.0 / (sumError.denominator() * sumChordCount),
-        sumChordCount* 1.0 / sumChordPlaces,
-        sumLengthOfRests,
-        voiceCount,
-        tupletIndexes.size()
-    };
-}
-
 #ifdef QT_DEBUG
 
 bool areCommonsDifferent(const std::vector<int>& selectedCommons)
@@ -343,87 +290,6 @@ bool areCommonsUncommon(const std::vector<int>& selectedCommons,
 
 #endif
 
-int findAvailableVoice(
-    size_t tupletIndex,
-    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
-    const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals)
-{
-    int voice = 0;
-    while (true) {
-        const auto it = voiceIntervals.find(voice);
-        if (it != voiceIntervals.end()
-            && haveIntersection(tupletIntervals[tupletIndex], it->second)) {
-            ++voice;
-            continue;
-        }
-        break;
-    }
-
-    return voice;
-}
-
-std::map<std::pair<const ReducedFraction, MidiChord>*, int>
-prepareUsedFirstChords(const std::vector<int>& selectedTuplets,
-                       const std::vector<TupletInfo>& tuplets)
-{
-    std::map<std::pair<const ReducedFraction, MidiChord>*, int> usedFirstChords;
-    for (int i: selectedTuplets) {
-        if (tuplets[i].firstChordIndex != 0) {
-            continue;
-        }
-        const auto firstChord = tuplets[i].chords.begin();
-        const auto it = usedFirstChords.find(&*firstChord->second);
-        if (it != usedFirstChords.end()) {
-            ++(it->second);
-        } else {
-            usedFirstChords.insert({ &*firstChord->second, 1 });
-        }
-    }
-
-    return usedFirstChords;
-}
-
-std::vector<int> findUnusedIndexes(const std::vector<int>& selectedTuplets)
-{
-    std::vector<int> unusedIndexes;
-    int k = 0;
-    for (int i = 0; i != selectedTuplets.back(); ++i) {
-        if (i == selectedTuplets[k]) {
-            ++k;
-            continue;
-        }
-        unusedIndexes.push_back(i);
-    }
-    return unusedIndexes;
-}
-
-bool canUseIndex(
-    int indexToCheck,
-    const std::vector<TupletInfo>& tuplets,
-    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
-    const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals,
-    const std::map<std::pair<const ReducedFraction, MidiChord>*, int>& usedFirstChords)
-{
-    const auto& tuplet = tuplets[indexToCheck];
-    // check tuplets for common 1st chord
-    if (tuplet.firstChordIndex == 0) {
-        const auto firstChord = tuplet.chords.begin();
-        const auto it = usedFirstChords.find(&*firstChord->second);
-        if (it != usedFirstChords.end() && !isMoreTupletVoicesAllowed(
-                it->second, it->first->second.notes.size())) {
-            return false;
-        }
-    }
-    // check tuplets for resulting voice count
-    const int voice = findAvailableVoice(indexToCheck, tupletIntervals, voiceIntervals);
-    const int voiceCount = qMax((int)voiceIntervals.size(), voice + 1);       // index + 1 = count
-    if (voiceCount > 1 && (int)tuplet.chords.size()
-        < tupletLimits(tuplet.tupletNumber).minNoteCountAddVoice) {
-        return false;
-    }
-    return true;
-}
-
 #ifdef QT_DEBUG
 
 bool areTupletChordsEmpty(const std::vector<TupletInfo>& tuplets)
@@ -467,37 +333,6 @@ bool validateSelectedTuplets(Iter beginIt,
 
 #endif
 
-void tryUpdateBestIndexes(
-    std::vector<int>& bestTupletIndexes,
-    TupletErrorResult& minCurrentError,
-    const std::vector<int>& selectedTuplets,
-    const std::vector<TupletInfo>& tuplets,
-    const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals,
-    const ReducedFraction& basicQuant)
-{
-    const size_t voiceCount = voiceIntervals.size();
-    const auto error = findTupletError(selectedTuplets, tuplets,
-                                       voiceCount, basicQuant);
-    if (!minCurrentError.isInitialized() || error < minCurrentError) {
-        minCurrentError = error;
-        bestTupletIndexes = selectedTuplets;
-    }
-}
-
-std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >
-prepareVoiceIntervals(
-    const std::vector<int>& selectedTuplets,
-    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals)
-{
-    // <voice, intervals>
-    std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > > voiceIntervals;
-    for (int i: selectedTuplets) {
-        int voice = findAvailableVoice(i, tupletIntervals, voiceIntervals);
-        voiceIntervals[voice].push_back(tupletIntervals[i]);
-    }
-    return voiceIntervals;
-}
-
 class ValidTuplets
 {
 public:
@@ -573,102 +408,438 @@ private:
     int first_;
 };
 
-void findNextTuplet(
-    std::vector<int>& selectedTuplets,
-    ValidTuplets& validTuplets,
-    std::vector<int>& bestTupletIndexes,
-    TupletErrorResult& minCurrentError,
-    const std::vector<TupletCommon>& tupletCommons,
-    const std::vector<TupletInfo>& tuplets,
-    const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
-    size_t commonsSize,
-    const ReducedFraction& basicQuant)
+// limits of the tuplet search in one bar, 0 means unlimited
+
+struct TupletSearchLimits
+{
+    size_t maxNodeCount = 0;
+    std::chrono::milliseconds maxTime{ 0 };
+};
+
+using TupletSearchClock = std::chrono::steady_clock::time_point (*)();
+
+int tupletSearchNodeLimitFromPreferences()
+{
+    auto conf = muse::modularity::globalIoc()->resolve<mu::iex::midi::IMidiImportExportConfiguration>("iex_midi");
+    return conf ? conf->tupletSearchNodeLimit() : 200000;
+}
+
+int tupletSearchTimeLimitFromPreferences()
+{
+    auto conf = muse::modularity::globalIoc()->resolve<mu::iex::midi::IMidiImportExportConfiguration>("iex_midi");
+    return conf ? conf->tupletSearchTimeLimit() : 0;
+}
+
+// time source of the search time limit, replaced in tests to reach the limit
+
+static TupletSearchClock s_tupletSearchClock = &std::chrono::steady_clock::now;
+
+TupletSearchClock setTupletSearchClock(TupletSearchClock clock)
 {
-    while (!validTuplets.empty()) {
-        size_t index = validTuplets.first();
+    return std::exchange(s_tupletSearchClock, clock);
+}
+
+TupletSearchLimits tupletSearchLimits()
+{
+    const auto& opers = midiImportOperations.data()->trackOpers;
+    const int nodeLimit = opers.tupletSearchNodeLimit.value();
+    const int timeLimit = opers.tupletSearchTimeLimit.value();
+
+    TupletSearchLimits limits;
+    limits.maxNodeCount = size_t(qMax(nodeLimit, 0));
+    limits.maxTime = std::chrono::milliseconds(qMax(timeLimit, 0));
+    return limits;
+}
 
-        bool isCommonGroupBegins = (selectedTuplets.empty() && index == commonsSize);
-        if (isCommonGroupBegins) {          // first level
-            for (size_t i = index; i < tuplets.size(); ++i) {
-                selectedTuplets.push_back(int(i));
+// depth-first search of the set of compatible tuplets with the minimal error;
+// voice intervals, uses of first chords and sums of the selected tuplets
+// are updated incrementally when a tuplet is selected or unselected,
+// and branches that cannot give a result better than the current best one are skipped
+
+class TupletSearch
+{
+public:
+    TupletSearch(const std::vector<TupletCommon>& tupletCommons,
+                 const std::vector<TupletInfo>& tuplets,
+                 size_t commonsSize,
+                 const ReducedFraction& basicQuant,
+                 const TupletSearchLimits& limits)
+        : tupletCommons_(tupletCommons)
+        , tuplets_(tuplets)
+        , commonsSize_(commonsSize)
+        , limits_(limits)
+        , tupletIntervals_(findTupletIntervals(tuplets, basicQuant))
+        , commons_(tuplets.size() * tuplets.size(), 0)
+        , tupletChords_(tuplets.size())
+        , firstChords_(tuplets.size(), -1)
+        , isSelected_(tuplets.size(), 0)
+        , sums_(1)
+    {
+        const size_t tupletCount = tuplets.size();
+        for (size_t i = 0; i != tupletCount; ++i) {
+            for (int j: tupletCommons[i].commonIndexes) {
+                commons_[i * tupletCount + j] = 1;
+                commons_[j * tupletCount + i] = 1;
             }
-        } else {
-            selectedTuplets.push_back(int(index));
         }
-#ifdef QT_DEBUG
-        Q_ASSERT_X(validateSelectedTuplets(selectedTuplets.begin(), selectedTuplets.end(), tuplets),
-                   "MIDI tuplets::findNextTuplet", "Tuplets have common chords but they shouldn't");
-#endif
 
-        const auto voiceIntervals = prepareVoiceIntervals(selectedTuplets, tupletIntervals);
-        const auto usedFirstChords = prepareUsedFirstChords(selectedTuplets, tuplets);
-#ifdef QT_DEBUG
-        Q_ASSERT_X(areCommonsDifferent(selectedTuplets), "MidiTuplet::findNextTuplet",
-                   "There are duplicates in selected commons");
-        Q_ASSERT_X(areCommonsUncommon(selectedTuplets, tupletCommons),
-                   "MidiTuplet::findNextTuplet", "Incompatible selected commons");
-#endif
-
-        if (isCommonGroupBegins) {
-            bool canAddMoreIndexes = false;
-            for (size_t i = 0; i != commonsSize; ++i) {
-                if (!isInCommonIndexes(int(i), selectedTuplets, tupletCommons)
-                    && canUseIndex(int(i), tuplets, tupletIntervals,
-                                   voiceIntervals, usedFirstChords)) {
-                    canAddMoreIndexes = true;
-                    break;
+        std::map<const std::pair<const ReducedFraction, MidiChord>*, int> chordIndexes;
+        for (size_t i = 0; i != tupletCount; ++i) {
+            const auto& tuplet = tuplets[i];
+            for (const auto& chord: tuplet.chords) {
+                const auto* chordPtr = &*chord.second;
+                auto it = chordIndexes.find(chordPtr);
+                if (it == chordIndexes.end()) {
+                    it = chordIndexes.insert({ chordPtr, int(quantErrors_.size()) }).first;
+                    quantErrors_.push_back(Quantize::findOnTimeQuantError(*chord.second, basicQuant));
+                    chordTupletCounts_.push_back(0);
                 }
+                ++chordTupletCounts_[it->second];
+                tupletChords_[i].push_back(it->second);
             }
-            if (!canAddMoreIndexes) {
-                tryUpdateBestIndexes(bestTupletIndexes, minCurrentError,
-                                     selectedTuplets, tuplets, voiceIntervals, basicQuant);
+            if (tuplet.firstChordIndex == 0) {
+                firstChords_[i] = tupletChords_[i].front();
             }
-            return;
         }
 
-        validTuplets.exclude(int(index));
-        const auto savedTuplets = validTuplets.save();
-        // check tuplets for compatibility
-        if (!validTuplets.empty()) {
-            for (int i: tupletCommons[index].commonIndexes) {
-                validTuplets.exclude(i);
-                if (validTuplets.empty()) {
-                    break;
+        const size_t chordCount = quantErrors_.size();
+        firstChordUses_.resize(chordCount, 0);
+        chordUses_.resize(chordCount, 0);
+        chordMarks_.resize(chordCount, 0);
+    }
+
+    std::vector<int> findBestTuplets()
+    {
+        startTime_ = s_tupletSearchClock();
+
+        ValidTuplets validTuplets(int(tuplets_.size()));
+        findNextTuplet(validTuplets);
+
+        if (isStopped_) {
+            LOGD() << "Tuplet search is stopped after " << nodeCount_ << " nodes, "
+                   << "the best tuplets found so far are used";
+            if (!minCurrentError_.isInitialized()) {
+                // fall back to the longest group of tuplets without common chords
+                bestTupletIndexes_.clear();
+                for (size_t i = commonsSize_; i < tuplets_.size(); ++i) {
+                    bestTupletIndexes_.push_back(int(i));
                 }
             }
         }
-        for (int i = validTuplets.first(); validTuplets.isValid(i);) {
-            if (!canUseIndex(i, tuplets, tupletIntervals,
-                             voiceIntervals, usedFirstChords)) {
-                i = validTuplets.exclude(i);
+
+        return bestTupletIndexes_;
+    }
+
+private:
+    struct SelectedSums
+    {
+        double tupletError = 0.0;
+        double lengthOfRests = 0.0;
+        size_t chordCount = 0;
+        int chordPlaces = 0;
+    };
+
+    void select(int index)
+    {
+        const int voice = findAvailableVoice(index);
+        if (voice == (int)voiceIntervals_.size()) {
+            voiceIntervals_.emplace_back();
+        }
+        voiceIntervals_[voice].push_back(tupletIntervals_[index]);
+        selectedVoices_.push_back(voice);
+
+        if (firstChords_[index] >= 0) {
+            ++firstChordUses_[firstChords_[index]];
+        }
+        for (int chord: tupletChords_[index]) {
+            ++chordUses_[chord];
+        }
+
+        const auto& tuplet = tuplets_[index];
+        SelectedSums sums = sums_.back();
+        sums.tupletError += tuplet.tupletSumError.toDouble();
+        sums.lengthOfRests += tuplet.sumLengthOfRests.toDouble();
+        sums.chordCount += tuplet.chords.size();
+        sums.chordPlaces += tuplet.tupletNumber;
+        sums_.push_back(sums);
+
+        selectedTuplets_.push_back(index);
+        isSelected_[index] = 1;
+    }
+
+    void unselect()
+    {
+        const int index = selectedTuplets_.back();
+        selectedTuplets_.pop_back();
+        isSelected_[index] = 0;
+        sums_.pop_back();
+
+        for (int chord: tupletChords_[index]) {
+            --chordUses_[chord];
+        }
+        if (firstChords_[index] >= 0) {
+            --firstChordUses_[firstChords_[index]];
+        }
+
+        const int voice = selectedVoices_.back();
+        selectedVoices_.pop_back();
+        voiceIntervals_[voice].pop_back();
+        if (voiceIntervals_[voice].empty()) {
+            // only the last voice can become empty
+            voiceIntervals_.pop_back();
+        }
+    }
+
+    int findAvailableVoice(int index) const
+    {
+        int voice = 0;
+        while (voice < (int)voiceIntervals_.size()
+               && haveIntersection(tupletIntervals_[index], voiceIntervals_[voice])) {
+            ++voice;
+        }
+        return voice;
+    }
+
+    bool isInCommonIndexes(int indexToCheck) const
+    {
+        const size_t row = indexToCheck * tuplets_.size();
+        for (int tupletIndex: selectedTuplets_) {
+            Q_ASSERT_X(indexToCheck != tupletIndex, "MidiTuplet::TupletSearch::isInCommonIndexes",
+                       "Checked indexes are the same but they should be different");
+
+            if (commons_[row + tupletIndex]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool canUseIndex(int indexToCheck) const
+    {
+        const auto& tuplet = tuplets_[indexToCheck];
+        // check tuplets for common 1st chord
+        const int firstChord = firstChords_[indexToCheck];
+        if (firstChord >= 0 && firstChordUses_[firstChord] > 0
+            && !isMoreTupletVoicesAllowed(firstChordUses_[firstChord],
+                                          tuplet.chords.begin()->second->second.notes.size())) {
+            return false;
+        }
+        // check tuplets for resulting voice count
+        const int voice = findAvailableVoice(indexToCheck);
+        const int voiceCount = qMax((int)voiceIntervals_.size(), voice + 1);     // index + 1 = count
+        if (voiceCount > 1 && (int)tuplet.chords.size()
+            < tupletLimits(tuplet.tupletNumber).minNoteCountAddVoice) {
+            return false;
+        }
+        return true;
+    }
+
+    // whether some of the unselected tuplets with index less than endIndex can be added
+    bool canAddMoreIndexes(int endIndex) const
+    {
+        for (int i = 0; i < endIndex; ++i) {
+            if (!isSelected_[i] && !isInCommonIndexes(i) && canUseIndex(i)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TupletErrorResult findTupletError() const
+    {
+        ReducedFraction sumError{ 0, 1 };
+        ReducedFraction sumLengthOfRests{ 0, 1 };
+        size_t sumChordCount = 0;
+        int sumChordPlaces = 0;
+
+        for (int i: selectedTuplets_) {
+            const auto& tuplet = tuplets_[i];
+
+            sumError += tuplet.tupletSumError;
+            sumLengthOfRests += tuplet.sumLengthOfRests;
+            sumChordCount += tuplet.chords.size();
+            sumChordPlaces += tuplet.tupletNumber;
+        }
+        // add quant error of all chords excluded from tuplets
+        for (size_t i = 0; i != tuplets_.size(); ++i) {
+            if (isSelected_[i]) {
                 continue;
             }
-            i = validTuplets.next(i);
-        }
-        if (validTuplets.empty()) {
-            const auto unusedIndexes = findUnusedIndexes(selectedTuplets);
-            bool canAddMoreIndexes = false;
-            for (int i: unusedIndexes) {
-                if (!isInCommonIndexes(i, selectedTuplets, tupletCommons)
-                    && canUseIndex(i, tuplets, tupletIntervals,
-                                   voiceIntervals, usedFirstChords)) {
-                    canAddMoreIndexes = true;
-                    break;
+            for (int chord: tupletChords_[i]) {
+                if (chordUses_[chord] == 0) {
+                    sumError += quantErrors_[chord];
                 }
             }
-            if (!canAddMoreIndexes) {
-                tryUpdateBestIndexes(bestTupletIndexes, minCurrentError,
-                                     selectedTuplets, tuplets, voiceIntervals, basicQuant);
+        }
+
+        return TupletErrorResult{
+            sumError.numerator() * 1.0 / (sumError.denominator() * sumChordCount),
+            sumChordCount* 1.0 / sumChordPlaces,
+            sumLengthOfRests,
+            voiceIntervals_.size(),
+            selectedTuplets_.size()
+        };
+    }
+
+    void tryUpdateBestIndexes()
+    {
+        const auto error = findTupletError();
+        if (!minCurrentError_.isInitialized() || error < minCurrentError_) {
+            minCurrentError_ = error;
+            bestTupletIndexes_ = selectedTuplets_;
+        }
+    }
+
+    // all results of the branch consist of the selected tuplets and some of the valid ones;
+    // find bounds of their error values and check them against the current best result
+
+    bool canImproveBest(const ValidTuplets& validTuplets)
+    {
+        if (!minCurrentError_.isInitialized()) {
+            return true;
+        }
+
+        const SelectedSums& sums = sums_.back();
+        size_t maxChordCount = sums.chordCount;
+        double maxRelativePlaces = sums.chordCount * 1.0 / sums.chordPlaces;
+
+        ++chordMark_;
+        for (int i = validTuplets.first(); validTuplets.isValid(i); i = validTuplets.next(i)) {
+            const auto& tuplet = tuplets_[i];
+            maxChordCount += tuplet.chords.size();
+            maxRelativePlaces = qMax(maxRelativePlaces, tuplet.chords.size() * 1.0 / tuplet.tupletNumber);
+            for (int chord: tupletChords_[i]) {
+                chordMarks_[chord] = chordMark_;
+            }
+        }
+        // chords that are neither in selected nor in valid tuplets stay outside tuplets
+        double minSumError = sums.tupletError;
+        for (size_t chord = 0; chord != quantErrors_.size(); ++chord) {
+            if (chordUses_[chord] == 0 && chordMarks_[chord] != chordMark_) {
+                minSumError += quantErrors_[chord].toDouble() * chordTupletCounts_[chord];
             }
-        } else {
-            findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                           tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
         }
 
-        selectedTuplets.pop_back();
-        validTuplets.restore(savedTuplets);
+        return !minCurrentError_.cannotBeImprovedBy(minSumError / maxChordCount,
+                                                    maxRelativePlaces,
+                                                    sums.lengthOfRests);
+    }
+
+    bool isBudgetExceeded()
+    {
+        const size_t TIME_CHECK_INTERVAL = 256;     // time is checked at the 1st node and then at every 256th one
+
+        if (isStopped_) {
+            return true;
+        }
+        ++nodeCount_;
+        if (limits_.maxNodeCount > 0 && nodeCount_ > limits_.maxNodeCount) {
+            isStopped_ = true;
+        } else if (limits_.maxTime.count() > 0 && nodeCount_ % TIME_CHECK_INTERVAL == 1
+                   && s_tupletSearchClock() - startTime_ > limits_.maxTime) {
+            isStopped_ = true;
+        }
+        return isStopped_;
     }
-}
+
+    void findNextTuplet(ValidTuplets& validTuplets)
+    {
+        while (!validTuplets.empty()) {
+            if (isBudgetExceeded()) {
+                return;
+            }
+
+            const int index = validTuplets.first();
+
+            const bool isCommonGroupBegins = (selectedTuplets_.empty() && index == (int)commonsSize_);
+            if (isCommonGroupBegins) {              // first level
+                for (int i = index; i < (int)tuplets_.size(); ++i) {
+                    select(i);
+                }
+            } else {
+                select(index);
+            }
+#ifdef QT_DEBUG
+            Q_ASSERT_X(validateSelectedTuplets(selectedTuplets_.begin(), selectedTuplets_.end(), tuplets_),
+                       "MIDI tuplets::findNextTuplet", "Tuplets have common chords but they shouldn't");
+            Q_ASSERT_X(areCommonsDifferent(selectedTuplets_), "MidiTuplet::findNextTuplet",
+                       "There are duplicates in selected commons");
+            Q_ASSERT_X(areCommonsUncommon(selectedTuplets_, tupletCommons_),
+                       "MidiTuplet::findNextTuplet", "Incompatible selected commons");
+#endif
+
+            if (isCommonGroupBegins) {
+                if (!canAddMoreIndexes(int(commonsSize_))) {
+                    tryUpdateBestIndexes();
+                }
+                while (!selectedTuplets_.empty()) {
+                    unselect();
+                }
+                return;
+            }
+
+            validTuplets.exclude(index);
+            const auto savedTuplets = validTuplets.save();
+            // check tuplets for compatibility
+            if (!validTuplets.empty()) {
+                for (int i: tupletCommons_[index].commonIndexes) {
+                    validTuplets.exclude(i);
+                    if (validTuplets.empty()) {
+                        break;
+                    }
+                }
+            }
+            for (int i = validTuplets.first(); validTuplets.isValid(i);) {
+                if (!canUseIndex(i)) {
+                    i = validTuplets.exclude(i);
+                    continue;
+                }
+                i = validTuplets.next(i);
+            }
+            if (validTuplets.empty()) {
+                if (!canAddMoreIndexes(selectedTuplets_.back())) {
+                    tryUpdateBestIndexes();
+                }
+            } else if (canImproveBest(validTuplets)) {
+                findNextTuplet(validTuplets);
+            }
+
+            unselect();
+            validTuplets.restore(savedTuplets);
+
+            if (isStopped_) {
+                return;
+            }
+        }
+    }
+
+    const std::vector<TupletCommon>& tupletCommons_;
+    const std::vector<TupletInfo>& tuplets_;
+    const size_t commonsSize_;
+    const TupletSearchLimits limits_;
+    const std::vector<std::pair<ReducedFraction, ReducedFraction> > tupletIntervals_;
+    std::vector<char> commons_;                 // tuplets x tuplets, 1 if tuplets have common chords
+    std::vector<std::vector<int> > tupletChords_;
+    std::vector<int> firstChords_;              // -1 if first chord of tuplet can't be shared
+    std::vector<ReducedFraction> quantErrors_;  // on time quant error of chord
+    std::vector<int> chordTupletCounts_;        // count of tuplets that contain chord
+
+    std::vector<int> selectedTuplets_;
+    std::vector<char> isSelected_;
+    std::vector<int> selectedVoices_;
+    std::vector<std::vector<std::pair<ReducedFraction, ReducedFraction> > > voiceIntervals_;
+    std::vector<int> firstChordUses_;
+    std::vector<int> chordUses_;
+    std::vector<SelectedSums> sums_;
+    std::vector<size_t> chordMarks_;
+    size_t chordMark_ = 0;
+
+    std::vector<int> bestTupletIndexes_;
+    TupletErrorResult minCurrentError_;
+    size_t nodeCount_ = 0;
+    bool isStopped_ = false;
+    std::chrono::steady_clock::time_point startTime_;
+};
 
 void moveUncommonTupletsToEnd(std::vector<TupletInfo>& tuplets, std::set<int>& uncommons)
 {
@@ -694,17 +865,8 @@ std::vector<int> findBestTuplets(
     size_t commonsSize,
     const ReducedFraction& basicQuant)
 {
-    std::vector<int> bestTupletIndexes;
-    std::vector<int> selectedTuplets;
-    TupletErrorResult minCurrentError;
-    const auto tupletIntervals = findTupletIntervals(tuplets, basicQuant);
-
-    ValidTuplets validTuplets(int(tuplets.size()));
-
-    findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                   tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
-
-    return bestTupletIndexes;
+    TupletSearch search(tupletCommons, tuplets, commonsSize, basicQuant, tupletSearchLimits());
+    return search.findBestTuplets();
 }
 
 void removeExtraTuplets(std::vector<TupletInfo>& tuplets)
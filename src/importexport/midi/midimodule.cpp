@@ -57,7 +57,7 @@ void MidiModule::resolveImports()
 
     auto writers = globalIoc()->resolve<INotationWritersRegister>(moduleName());
     if (writers) {
-        writers->reg({ "mid", "midi", "kar" }, std::make_shared<NotationMidiWriter>(globalCtx()));
+        writers->reg({ "mid", "midi", "kar" }, []() { return std::make_shared<NotationMidiWriter>(globalCtx()); });
     }
 }
 
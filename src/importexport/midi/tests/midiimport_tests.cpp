@@ -19,6 +19,7 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
+#include <chrono>
 #include <memory>
 
 #include <QString>
@@ -38,6 +39,7 @@
 #include "importexport/midi/internal/midiimport/importmidi_operations.h"
 #include "importexport/midi/internal/midiimport/importmidi_quant.h"
 #include "importexport/midi/internal/midiimport/importmidi_tuplet.h"
+#include "importexport/midi/internal/midiimport/importmidi_tuplet_filter.h"
 
 using namespace muse;
 using namespace mu;
@@ -57,6 +59,9 @@ TupletInfo findTupletApproximation(const ReducedFraction& tupletLen, int tupletN
                                                        MidiChord>::iterator& endChordIt);
 void splitFirstTupletChords(std::vector<TupletInfo>& tuplets, std::multimap<ReducedFraction, MidiChord>& chords);
 std::set<int> findLongestUncommonGroup(const std::vector<TupletInfo>& tuplets, const ReducedFraction& basicQuant);
+
+using TupletSearchClock = std::chrono::steady_clock::time_point (*)();
+TupletSearchClock setTupletSearchClock(TupletSearchClock clock);
 }
 
 namespace Meter {
@@ -144,6 +149,32 @@ protected:
         importThenCompareWithRef(file);
     }
 
+    // imports the file with the tracks analysed one after another and on worker threads
+    // and compares the results
+    void parallelImportMatchesSerial(const char* file)
+    {
+        const String fileName = String::fromUtf8(file);
+        const String filePath = midiFilePath(fileName);
+        auto& opers = midiImportOperations;
+        opers.addNewMidiFile(filePath);
+        MidiOperations::CurrentMidiFileSetter setCurrentMidiFile(opers, filePath);
+        auto& isParallelImport = opers.data()->trackOpers.isParallelImport;
+
+        isParallelImport.setValue(false);
+        std::unique_ptr<engraving::MasterScore> serialScore = importMidi(filePath);
+        isParallelImport.setValue(true);
+        std::unique_ptr<engraving::MasterScore> parallelScore = importMidi(filePath);
+        isParallelImport.setValue(false);
+        ASSERT_TRUE(serialScore);
+        ASSERT_TRUE(parallelScore);
+
+        const String serialPath = fileName + u"-serial.mscx";
+        const String parallelPath = fileName + u"-parallel.mscx";
+        ASSERT_TRUE(engraving::ScoreRW::saveScore(serialScore.get(), serialPath));
+        ASSERT_TRUE(engraving::ScoreRW::saveScore(parallelScore.get(), parallelPath));
+        EXPECT_TRUE(engraving::ScoreComp::compareFiles(serialPath, parallelPath));
+    }
+
     void importThenCompareWithRef(const char* file);
     std::unique_ptr<engraving::MasterScore> importMidi(const String& fileName);
 
@@ -683,6 +714,24 @@ TEST_F(MidiImportTests, instrument3StaffOrgan) {
     importThenCompareWithRef("instrument_3staff_organ");
 }
 
+// parallel import
+
+TEST_F(MidiImportTests, parallelImportChannels) {
+    parallelImportMatchesSerial("instrument_channels");
+}
+
+TEST_F(MidiImportTests, parallelImportDrums) {
+    parallelImportMatchesSerial("perc_drums");
+}
+
+TEST_F(MidiImportTests, parallelImportTriplets) {
+    parallelImportMatchesSerial("perc_triplet");
+}
+
+TEST_F(MidiImportTests, parallelImportMeter12_8) {
+    parallelImportMatchesSerial("meter_12-8");
+}
+
 TEST_F(MidiImportTests, instrumentClef) {
     noTempoText("instrument_clef");
 }
@@ -1204,6 +1253,108 @@ TEST_F(MidiImportTests, findLongestUncommonGroup) {
     EXPECT_EQ(result.size(), 1);
 }
 
+// three triplets of quarter length one after another, the first one is not in the longest uncommon group
+
+static std::vector<MidiTuplet::TupletInfo> successiveTriplets(std::multimap<ReducedFraction, MidiChord>& chords)
+{
+    std::vector<MidiTuplet::TupletInfo> tuplets;
+    for (int i = 0; i != 3; ++i) {
+        MidiTuplet::TupletInfo tupletInfo;
+        tupletInfo.id = i;
+        tupletInfo.tupletNumber = 3;
+        tupletInfo.onTime = ReducedFraction::fromTicks(engraving::Constants::DIVISION * i);
+        tupletInfo.len = ReducedFraction::fromTicks(engraving::Constants::DIVISION);
+        tupletInfo.tupletSumError = { 0, 1 };
+        tupletInfo.regularSumError = ReducedFraction::fromTicks(1);
+        tupletInfo.sumLengthOfRests = { 0, 1 };
+        tupletInfo.firstChordIndex = 0;
+        for (int j = 0; j != tupletInfo.tupletNumber; ++j) {
+            MidiChord chord;
+            MidiNote note;
+            const ReducedFraction onTime = tupletInfo.onTime + tupletInfo.len / tupletInfo.tupletNumber * j;
+            note.pitch = 60;
+            note.offTime = onTime + tupletInfo.len / tupletInfo.tupletNumber;
+            chord.notes.push_back(note);
+            const auto chordIt = chords.insert({ onTime, chord });
+            tupletInfo.chords.insert({ onTime, chordIt });
+        }
+        tuplets.push_back(tupletInfo);
+    }
+    return tuplets;
+}
+
+static std::set<int> tupletOnTimes(const std::vector<MidiTuplet::TupletInfo>& tuplets)
+{
+    std::set<int> onTimes;
+    for (const auto& tuplet: tuplets) {
+        onTimes.insert(tuplet.onTime.ticks());
+    }
+    return onTimes;
+}
+
+// clock that runs one second forward at each call
+static std::chrono::steady_clock::time_point fastClock()
+{
+    static std::chrono::steady_clock::time_point time;
+    time += std::chrono::seconds(1);
+    return time;
+}
+
+TEST_F(MidiImportTests, tupletSearchLimits) {
+    auto& opers = midiImportOperations;
+    const QString fileName = "tupletSearchLimits";
+    opers.addNewMidiFile(fileName);
+    MidiOperations::CurrentMidiFileSetter setCurrentMidiFile(opers, fileName);
+    auto& trackOpers = opers.data()->trackOpers;
+
+    const ReducedFraction basicQuant = ReducedFraction::fromTicks(engraving::Constants::DIVISION) / 4;    // 1/16
+    const int div = engraving::Constants::DIVISION;
+
+    // unlimited search: all the tuplets are compatible and selected
+    trackOpers.tupletSearchNodeLimit.setValue(0);
+    trackOpers.tupletSearchTimeLimit.setValue(0);
+    {
+        std::multimap<ReducedFraction, MidiChord> chords;
+        auto tuplets = successiveTriplets(chords);
+        MidiTuplet::filterTuplets(tuplets, basicQuant);
+        EXPECT_EQ(tupletOnTimes(tuplets), std::set<int>({ 0, div, 2 * div }));
+    }
+
+    // node limit: the search stops before any result is found,
+    // the longest group of tuplets without common chords is used
+    trackOpers.tupletSearchNodeLimit.setValue(1);
+    trackOpers.tupletSearchTimeLimit.setValue(0);
+    {
+        std::multimap<ReducedFraction, MidiChord> chords;
+        auto tuplets = successiveTriplets(chords);
+        MidiTuplet::filterTuplets(tuplets, basicQuant);
+        EXPECT_EQ(tupletOnTimes(tuplets), std::set<int>({ div, 2 * div }));
+    }
+
+    // time limit: the same fallback when the time is over at the first node
+    trackOpers.tupletSearchNodeLimit.setValue(0);
+    trackOpers.tupletSearchTimeLimit.setValue(1);
+    {
+        const auto prevClock = MidiTuplet::setTupletSearchClock(&fastClock);
+        std::multimap<ReducedFraction, MidiChord> chords;
+        auto tuplets = successiveTriplets(chords);
+        MidiTuplet::filterTuplets(tuplets, basicQuant);
+        MidiTuplet::setTupletSearchClock(prevClock);
+        EXPECT_EQ(tupletOnTimes(tuplets), std::set<int>({ div, 2 * div }));
+    }
+
+    // time limit that is not exceeded doesn't change the result
+    trackOpers.tupletSearchTimeLimit.setValue(1000 * 1000);
+    {
+        const auto prevClock = MidiTuplet::setTupletSearchClock(&fastClock);
+        std::multimap<ReducedFraction, MidiChord> chords;
+        auto tuplets = successiveTriplets(chords);
+        MidiTuplet::filterTuplets(tuplets, basicQuant);
+        MidiTuplet::setTupletSearchClock(prevClock);
+        EXPECT_EQ(tupletOnTimes(tuplets), std::set<int>({ 0, div, 2 * div }));
+    }
+}
+
 //---------------------------------------------------------
 //  metric bar analysis
 //---------------------------------------------------------
@@ -52,7 +52,7 @@ void MnxModule::resolveImports()
     }
     auto writers = globalIoc()->resolve<INotationWritersRegister>(moduleName());
     if (writers) {
-        writers->reg({ "mnx" }, std::make_shared<NotationMnxWriter>(globalCtx()));
+        writers->reg({ "mnx" }, []() { return std::make_shared<NotationMnxWriter>(globalCtx()); });
     }
 }
 
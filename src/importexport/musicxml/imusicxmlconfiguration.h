@@ -57,6 +57,9 @@ public:
     virtual bool exportInvisibleElements() const = 0;
     virtual void setExportInvisibleElements(bool value) = 0;
 
+    virtual bool exportParallel() const = 0;
+    virtual void setExportParallel(bool value) = 0;
+
     virtual bool needUseDefaultFont() const = 0;
     virtual void setNeedUseDefaultFont(bool value) = 0;
     virtual muse::async::Channel<bool> needUseDefaultFontChanged() const = 0;
@@ -36,8 +36,17 @@
 #include "exportmusicxml.h"
 
 #include <math.h>
+#include <memory>
 #include <set>
 
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include <mutex>
+
+#include "engraving/infrastructure/parallelfor.h"
+#endif
+
 #include "containers.h"
 #include "realfn.h"
 #include "io/iodevice.h"
@@ -246,6 +255,7 @@ class SlurHandler
 public:
     SlurHandler();
     void doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml);
+    bool empty() const;
 
 private:
     void doSlurStart(const Slur* s, Notations& notations, String tagName, XmlWriter& xml);
@@ -266,6 +276,7 @@ public:
     GlissandoHandler();
     void doGlissandoStart(Glissando* gliss, Notations& notations, XmlWriter& xml);
     void doGlissandoStop(Glissando* gliss, Notations& notations, XmlWriter& xml);
+    bool empty() const;
 
 private:
     int findNote(const Note* note, int type) const;
@@ -338,6 +349,14 @@ public:
         m_div = 1;
         m_tenths = 40;
         m_millimeters = m_score->style().spatium() * m_tenths / (10 * DPMM);
+
+        for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+            m_brackets[i] = nullptr;
+            m_dashes[i] = nullptr;
+            m_hairpins[i] = nullptr;
+            m_ottavas[i] = nullptr;
+            m_trills[i] = nullptr;
+        }
     }
 
     void write(muse::io::IODevice* dev);
@@ -407,7 +426,13 @@ private:
                       const MeasurePrintContext& mpc, std::set<const Spanner*>& spannersStopped);
     void repeatAtMeasureStart(Attributes& attr, const Measure* const m, track_idx_t strack, track_idx_t etrack, track_idx_t track);
     void repeatAtMeasureStop(const Measure* const m, track_idx_t strack, track_idx_t etrack, track_idx_t track);
-    void writeParts();
+    void writePart(const size_t partIndex, const int staffCount);
+    void writeParts(muse::io::IODevice* dev);
+#ifdef MUSE_THREADS_SUPPORT
+    void writePartsConcurrently(muse::io::IODevice* dev, const std::vector<int>& staffCounts);
+#endif
+    bool hasOpenPartState() const;
+    void copyOpenPartState(const ExportMusicXml& other);
     bool shouldWritePageNo(const Page* page);
 
     static String elementPosition(const ExportMusicXml* const expMxml, const EngravingItem* const elm);
@@ -436,7 +461,7 @@ private:
     TrillHash m_trillStart;
     TrillHash m_trillStop;
     MusicXmlInstrumentMap m_instrMap;
-    PlayingTechniqueType m_currPlayTechnique;
+    PlayingTechniqueType m_currPlayTechnique = PlayingTechniqueType::Undefined;
 };
 
 //---------------------------------------------------------
@@ -841,6 +866,20 @@ static const ChordRest* findFirstChordRest(const Slur* s)
     }
 }
 
+//---------------------------------------------------------
+//   empty -- return true if no slur is on the slur list
+//---------------------------------------------------------
+
+bool SlurHandler::empty() const
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (m_slur[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------
 //   doSlurs
 //---------------------------------------------------------
@@ -1035,6 +1074,20 @@ int GlissandoHandler::findNote(const Note* note, int type) const
     return -1;
 }
 
+//---------------------------------------------------------
+//   empty -- return true if no glissando is in the note tables
+//---------------------------------------------------------
+
+bool GlissandoHandler::empty() const
+{
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (m_glissNote[i] || m_slideNote[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------
 //   doGlissandoStart
 //---------------------------------------------------------
@@ -1745,26 +1798,27 @@ static String tick2xml(const Fraction& ticks, int* dots)
 
 //---------------------------------------------------------
 //   findVolta -- find volta starting in measure m
+//    Doesn't use the shared result list of the spanner map,
+//    parts may be written concurrently.
 //---------------------------------------------------------
 
 static Volta* findVolta(const Measure* const m, bool left, const track_idx_t track)
 {
     Fraction stick = m->tick();
     Fraction etick = m->endTick();
-    auto spanners = m->score()->spannerMap().findOverlapping(stick.ticks(), etick.ticks());
-    for (auto i : spanners) {
+    Volta* volta = nullptr;
+    m->score()->spannerMap().visitOverlapping(stick.ticks(), etick.ticks(), [&](const interval_tree::Interval<Spanner*>& i) {
         Spanner* el = i.value;
-        if (!el->isVolta() || track2staff(el->track()) != track2staff(track)) {
-            continue;
+        if (volta || !el->isVolta() || track2staff(el->track()) != track2staff(track)) {
+            return;
         }
         if (left && el->tick() == stick) {
-            return (Volta*)el;
-        }
-        if (!left && el->tick2() == etick) {
-            return (Volta*)el;
+            volta = toVolta(el);
+        } else if (!left && el->tick2() == etick) {
+            volta = toVolta(el);
         }
-    }
-    return nullptr;
+    });
+    return volta;
 }
 
 //---------------------------------------------------------
@@ -7032,6 +7086,11 @@ void ExportMusicXml::keysigTimesig(const Measure* m, const Part* p)
         if (m->tick().isZero()) {
             //KeySigEvent kse;
             //kse.setKey(Key::C);
+#ifdef MUSE_THREADS_SUPPORT
+            // parts may be written concurrently, they share the dummy segment
+            static std::mutex dummySegmentMutex;
+            std::lock_guard<std::mutex> lock(dummySegmentMutex);
+#endif
             KeySig* ks = Factory::createKeySig(m_score->dummy()->segment());
             ks->setKey(Key::C);
             keysig(ks, p->staff(0)->clef(m->tick()));
@@ -8621,76 +8680,252 @@ bool ExportMusicXml::shouldWritePageNo(const Page* page)
 }
 
 //---------------------------------------------------------
-//  writeParts
+//  writePart
 //---------------------------------------------------------
 
 /**
- Write all parts.
+ Write the part with index \a partIndex, whose first staff is \a staffCount.
  */
 
-void ExportMusicXml::writeParts()
+void ExportMusicXml::writePart(const size_t partIndex, const int staffCount)
 {
-    int staffCount = 0;
-    const auto& parts = m_score->parts();
-
-    for (size_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
-        const Part* part = parts.at(partIndex);
-        m_tick = { 0, 1 };
-        m_xml.startElementRaw(String(u"part id=\"P%1\"").arg(partIndex + 1));
+    const Part* part = m_score->parts().at(partIndex);
+    m_tick = { 0, 1 };
+    m_xml.startElementRaw(String(u"part id=\"P%1\"").arg(partIndex + 1));
 
-        m_trillStart.clear();
-        m_trillStop.clear();
-        initInstrMap(m_instrMap, part->instruments(), m_score);
+    m_trillStart.clear();
+    m_trillStop.clear();
+    initInstrMap(m_instrMap, part->instruments(), m_score);
 
-        MeasureNumberStateHandler mnsh;
-        FigBassMap fbMap;                     // pending figured bass extends
+    MeasureNumberStateHandler mnsh;
+    FigBassMap fbMap;                     // pending figured bass extends
 
-        // set of spanners already stopped in this part
-        // required to prevent multiple spanner stops for the same spanner
-        std::set<const Spanner*> spannersStopped;
+    // set of spanners already stopped in this part
+    // required to prevent multiple spanner stops for the same spanner
+    std::set<const Spanner*> spannersStopped;
 
-        const auto& pages = m_score->pages();
-        MeasurePrintContext mpc;
+    const auto& pages = m_score->pages();
+    MeasurePrintContext mpc;
 
-        for (size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
-            const Page* page = pages.at(pageIndex);
-            mpc.pageStart = true;
-            mpc.pageNumber = page->pageNumber() + 1 + m_score->pageNumberOffset();
-            mpc.writePageNo = shouldWritePageNo(page);
-            const auto& systems = page->systems();
+    for (size_t pageIndex = 0; pageIndex < pages.size(); ++pageIndex) {
+        const Page* page = pages.at(pageIndex);
+        mpc.pageStart = true;
+        mpc.pageNumber = page->pageNumber() + 1 + m_score->pageNumberOffset();
+        mpc.writePageNo = shouldWritePageNo(page);
+        const auto& systems = page->systems();
 
-            for (int systemIndex = 0; systemIndex < static_cast<int>(systems.size()); ++systemIndex) {
-                const System* system = systems.at(systemIndex);
-                mpc.systemStart = true;
+        for (int systemIndex = 0; systemIndex < static_cast<int>(systems.size()); ++systemIndex) {
+            const System* system = systems.at(systemIndex);
+            mpc.systemStart = true;
 
-                for (const MeasureBase* mb : system->measures()) {
-                    if (!mb->isMeasure()) {
-                        continue;
-                    }
-                    const Measure* m = toMeasure(mb);
-
-                    if (m->isMMRest()) {
-                        // in case of a multimeasure rest (which is a single measure in MuseScore), write the measure range it replaces
-                        const Measure* m2 = m->mmRestLast()->nextMeasure();
-                        for (Measure* m1 = m->mmRestFirst(); m1 != m2; m1 = m1->nextMeasure()) {
-                            if (m1->isMeasure()) {
-                                writeMeasure(m1, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
-                                mpc.measureWritten(m1);
-                            }
+            for (const MeasureBase* mb : system->measures()) {
+                if (!mb->isMeasure()) {
+                    continue;
+                }
+                const Measure* m = toMeasure(mb);
+
+                if (m->isMMRest()) {
+                    // in case of a multimeasure rest (which is a single measure in MuseScore), write the measure range it replaces
+                    const Measure* m2 = m->mmRestLast()->nextMeasure();
+                    for (Measure* m1 = m->mmRestFirst(); m1 != m2; m1 = m1->nextMeasure()) {
+                        if (m1->isMeasure()) {
+                            writeMeasure(m1, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
+                            mpc.measureWritten(m1);
                         }
-                    } else {
-                        // write the measure (or, if measure repeat, the "underlying" measure that it indicates for the musician to play)
-                        writeMeasure(m, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
-                        mpc.measureWritten(m);
                     }
+                } else {
+                    // write the measure (or, if measure repeat, the "underlying" measure that it indicates for the musician to play)
+                    writeMeasure(m, static_cast<int>(partIndex), staffCount, mnsh, fbMap, mpc, spannersStopped);
+                    mpc.measureWritten(m);
                 }
-                mpc.prevSystem = system;
             }
-            mpc.lastSystemPrevPage = mpc.prevSystem;
+            mpc.prevSystem = system;
         }
+        mpc.lastSystemPrevPage = mpc.prevSystem;
+    }
 
+    m_xml.endElement();
+}
+
+//---------------------------------------------------------
+//  hasOpenPartState
+//---------------------------------------------------------
+
+/**
+ Return true if the part just written left state that affects
+ writing the next part: spanners still holding a number, or
+ a pizzicato that is not cancelled yet.
+ */
+
+bool ExportMusicXml::hasOpenPartState() const
+{
+    if (!m_sh.empty() || !m_gh.empty() || m_currPlayTechnique == PlayingTechniqueType::Pizzicato) {
+        return true;
+    }
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        if (m_brackets[i] || m_dashes[i] || m_hairpins[i] || m_ottavas[i] || m_trills[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//  copyOpenPartState
+//---------------------------------------------------------
+
+/**
+ Continue from the state \a other was left in after writing a part.
+ */
+
+void ExportMusicXml::copyOpenPartState(const ExportMusicXml& other)
+{
+    m_sh = other.m_sh;
+    m_gh = other.m_gh;
+    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
+        m_brackets[i] = other.m_brackets[i];
+        m_dashes[i] = other.m_dashes[i];
+        m_hairpins[i] = other.m_hairpins[i];
+        m_ottavas[i] = other.m_ottavas[i];
+        m_trills[i] = other.m_trills[i];
+    }
+    m_currPlayTechnique = other.m_currPlayTechnique;
+}
+
+#ifdef MUSE_THREADS_SUPPORT
+//---------------------------------------------------------
+//  textsHaveLayoutData
+//---------------------------------------------------------
+
+/**
+ Return true if all texts of \a score have up to date layout data.
+ Reading the text of an element without it creates a temporary copy of the element,
+ which changes the children of the shared parent, the selection and the command state,
+ so parts can't be written concurrently then.
+ */
+
+static bool textsHaveLayoutData(Score* score)
+{
+    bool result = true;
+    score->scanElements([&result](EngravingItem* e) {
+        if (result && e->isTextBase()) {
+            const TextBase::LayoutData* ldata = toTextBase(e)->ldata();
+            result = ldata && !ldata->layoutInvalid;
+        }
+    });
+    return result;
+}
+
+//---------------------------------------------------------
+//  writePartsConcurrently
+//---------------------------------------------------------
+
+/**
+ Write all parts to \a dev, each part is written into its own buffer
+ by its own exporter on a worker thread. All texts must have layout data
+ (see textsHaveLayoutData()). The lazily built lookups of the score are
+ updated before the workers start, so the workers only read them.
+ The workers start from a clean state. A part following a part that
+ left open state (see hasOpenPartState()) is written again, continuing
+ from that state, so the result is identical to writeParts().
+ */
+
+void ExportMusicXml::writePartsConcurrently(muse::io::IODevice* dev, const std::vector<int>& staffCounts)
+{
+    struct PartBuffer {
+        ByteArray data;
+        size_t offset = 0;
+        std::unique_ptr<ExportMusicXml> openState;
+    };
+
+    std::vector<PartBuffer> partBuffers(staffCounts.size());
+
+    auto writePartBuffer = [this, &staffCounts, &partBuffers](size_t partIndex) {
+        PartBuffer& partBuffer = partBuffers.at(partIndex);
+        auto buf = Buffer::opened(IODevice::WriteOnly, &partBuffer.data);
+
+        ExportMusicXml exporter(m_score);
+        exporter.m_div = m_div;
+        exporter.m_jumpElements = m_jumpElements;
+        exporter.m_xml.setDevice(&buf);
+
+        // the part is written inside its parent element, to get the same indentation as in the score
+        exporter.m_xml.startElement("score-partwise");
+        exporter.m_xml.flush();
+        partBuffer.offset = partBuffer.data.size();
+
+        exporter.writePart(partIndex, staffCounts.at(partIndex));
+        exporter.m_xml.flush();
+
+        if (exporter.hasOpenPartState()) {
+            partBuffer.openState = std::make_unique<ExportMusicXml>(m_score);
+            partBuffer.openState->copyOpenPartState(exporter);
+        }
+    };
+
+    m_score->spannerMap().flush();
+    for (const Measure* m = m_score->firstMeasure(); m; m = m->nextMeasure()) {
+        m->segments().updateTickIndex();
+        if (m->mmRest()) {
+            m->mmRest()->segments().updateTickIndex();
+        }
+    }
+
+    parallelFor(partBuffers.size(), writePartBuffer);
+
+    m_xml.flush();
+
+    bool openState = false;
+    for (size_t partIndex = 0; partIndex < partBuffers.size(); ++partIndex) {
+        const PartBuffer& partBuffer = partBuffers.at(partIndex);
+        if (openState) {
+            // continue from the state the previous part was left in
+            writePart(partIndex, staffCounts.at(partIndex));
+            m_xml.flush();
+            openState = hasOpenPartState();
+            continue;
+        }
+
+        dev->write(partBuffer.data.constData() + partBuffer.offset, partBuffer.data.size() - partBuffer.offset);
+        if (partBuffer.openState) {
+            copyOpenPartState(*partBuffer.openState);
+            openState = true;
+        }
+    }
+}
+
+#endif
+
+//---------------------------------------------------------
+//  writeParts
+//---------------------------------------------------------
+
+/**
+ Write all parts.
+ */
+
+void ExportMusicXml::writeParts(muse::io::IODevice* dev)
+{
+    const auto& parts = m_score->parts();
+
+    std::vector<int> staffCounts;
+    int staffCount = 0;
+    for (const Part* part : parts) {
+        staffCounts.push_back(staffCount);
         staffCount += static_cast<int>(part->nstaves());
-        m_xml.endElement();
+    }
+
+#ifdef MUSE_THREADS_SUPPORT
+    if (parts.size() > 1 && configuration()->exportParallel() && textsHaveLayoutData(m_score)) {
+        writePartsConcurrently(dev, staffCounts);
+        return;
+    }
+#else
+    UNUSED(dev);
+#endif
+
+    for (size_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
+        writePart(partIndex, staffCounts.at(partIndex));
     }
 }
 
@@ -8725,14 +8960,6 @@ void ExportMusicXml::write(muse::io::IODevice* dev)
 {
     calcDivisions();
 
-    for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
-        m_brackets[i] = nullptr;
-        m_dashes[i] = nullptr;
-        m_hairpins[i] = nullptr;
-        m_ottavas[i] = nullptr;
-        m_trills[i] = nullptr;
-    }
-
     m_jumpElements = findJumpElements(m_score);
 
     m_xml.setDevice(dev);
@@ -8755,7 +8982,7 @@ void ExportMusicXml::write(muse::io::IODevice* dev)
     }
 
     partList(m_xml, m_score, m_instrMap);
-    writeParts();
+    writeParts(dev);
 
     m_xml.endElement();
     m_xml.flush();
@@ -20,6 +20,14 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <functional>
+
+#include "muse_framework_config.h"
+
+#ifdef MUSE_THREADS_SUPPORT
+#include <future>
+#endif
+
 #include "global/translation.h"
 
 #ifndef MUSICXML_NO_INTERACTIVE
@@ -83,10 +91,15 @@ static IInteractive::Button musicXmlImportErrorDialog(const muse::modularity::Co
 #endif
 
 //---------------------------------------------------------
-//   importMusicXmlfromBuffer
+//   doImport
 //---------------------------------------------------------
 
-Err importMusicXmlfromBuffer(Score* score, const String& /*name*/, const ByteArray& data)
+/**
+ Import MusicXML \a data into \a score. If set, \a validate is called after pass 1,
+ the import stops if it doesn't return Err::NoError.
+ */
+
+static Err doImport(Score* score, const ByteArray& data, const std::function<Err()>& validate)
 {
     MusicXmlLogger logger;
     logger.setLoggingLevel(MusicXmlLogger::Level::MXML_ERROR);   // errors only
@@ -98,6 +111,13 @@ Err importMusicXmlfromBuffer(Score* score, const String& /*name*/, const ByteArr
     Err res = pass1.parse(data);
     const String pass1_errors = pass1.errors();
 
+    if (validate) {
+        const Err validationRes = validate();
+        if (validationRes != Err::NoError) {
+            return validationRes;
+        }
+    }
+
     // pass 2
     MusicXmlParserPass2 pass2(score, pass1, &logger);
     if (res == Err::NoError) {
@@ -127,6 +147,15 @@ Err importMusicXmlfromBuffer(Score* score, const String& /*name*/, const ByteArr
     return res;
 }
 
+//---------------------------------------------------------
+//   importMusicXmlfromBuffer
+//---------------------------------------------------------
+
+Err importMusicXmlfromBuffer(Score* score, const String& /*name*/, const ByteArray& data)
+{
+    return doImport(score, data, nullptr);
+}
+
 //---------------------------------------------------------
 //   check assertions for tuplet handling
 //---------------------------------------------------------
@@ -197,18 +226,27 @@ static bool extractRootfile(const String& name, ByteArray& data)
 
 static Err doValidateAndImport(Score* score, const String& name, const ByteArray& data, bool forceMode)
 {
-    Err res;
-
-    if (!forceMode) {
-        // Validate the file
-        res = MusicXmlValidation::validate(name, data);
-        if (res != Err::NoError) {
-            return res;
-        }
+    if (forceMode) {
+        return doImport(score, data, nullptr);
     }
 
+#ifdef MUSE_THREADS_SUPPORT
+    // Validate the file while pass 1 is running, the user is asked
+    // about an invalid file before pass 2 starts
+    std::future<MusicXmlValidation::Result> validation = std::async(std::launch::async, [&name, &data]() {
+        return MusicXmlValidation::check(name, data);
+    });
+
+    // actually do the import
+    Err res = doImport(score, data, [&name, &validation]() {
+        return MusicXmlValidation::handleResult(name, validation.get());
+    });
+#else
     // actually do the import
-    res = importMusicXmlfromBuffer(score, name, data);
+    Err res = doImport(score, data, [&name, &data]() {
+        return MusicXmlValidation::validate(name, data);
+    });
+#endif
     //LOGD("res %d", static_cast<int>(res));
     return res;
 }
@@ -32,6 +32,16 @@ Err MusicXmlValidation::validate(const muse::String&, const muse::ByteArray&)
     return Err::NoError;
 }
 
+MusicXmlValidation::Result MusicXmlValidation::check(const muse::String&, const muse::ByteArray&)
+{
+    return Result();
+}
+
+Err MusicXmlValidation::handleResult(const muse::String&, const Result&)
+{
+    return Err::NoError;
+}
+
 #else
 
 #include <QAbstractMessageHandler>
@@ -175,30 +185,48 @@ static int musicXmlValidationErrorDialog(QString text, QString detailedText)
 }
 
 Err MusicXmlValidation::validate(const String& name, const muse::ByteArray& data)
+{
+    return handleResult(name, check(name, data));
+}
+
+MusicXmlValidation::Result MusicXmlValidation::check(const String& name, const muse::ByteArray& data)
 {
     //QElapsedTimer t;
     //t.start();
 
+    Result result;
+
     // initialize the schema
     ValidatorMessageHandler messageHandler;
     QXmlSchema schema;
     schema.setMessageHandler(&messageHandler);
     if (!initMusicXmlSchema(schema)) {
-        return Err::FileBadFormat;      // appropriate error message has been printed by initMusicXmlSchema
+        result.error = Err::FileBadFormat;      // appropriate error message has been printed by initMusicXmlSchema
+        return result;
     }
     // validate the data
     QXmlSchemaValidator validator(schema);
     const QByteArray qdata = data.toQByteArrayNoCopy();
-    bool valid = validator.validate(qdata, QUrl::fromLocalFile(name));
+    result.valid = validator.validate(qdata, QUrl::fromLocalFile(name));
+    result.errors = String::fromQString(messageHandler.getErrors());
     //LOGD("Validation time elapsed: %d ms", t.elapsed());
 
-    if (!valid) {
+    return result;
+}
+
+Err MusicXmlValidation::handleResult(const String& name, const Result& result)
+{
+    if (result.error != Err::NoError) {
+        return result.error;
+    }
+
+    if (!result.valid) {
         LOGD("importMusicXml() file '%s' is not a valid MusicXML file", muPrintable(name));
         QString strErr = muse::qtrc("iex_musicxml", "File “%1” is not a valid MusicXML file.").arg(name);
         if (MScore::noGui) {
             return Err::NoError;         // might as well try anyhow in converter mode
         }
-        if (musicXmlValidationErrorDialog(strErr, messageHandler.getErrors()) != QMessageBox::Yes) {
+        if (musicXmlValidationErrorDialog(strErr, result.errors.toQString()) != QMessageBox::Yes) {
             return Err::UserAbort;
         }
     }
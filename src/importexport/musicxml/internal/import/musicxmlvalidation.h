@@ -29,7 +29,17 @@ namespace mu::iex::musicxml {
 class MusicXmlValidation
 {
 public:
+    struct Result {
+        engraving::Err error = engraving::Err::NoError;
+        bool valid = true;
+        muse::String errors;
+    };
 
     static engraving::Err validate(const muse::String& name, const muse::ByteArray& data);
+
+    // validate() in two steps: check() shows no dialogs and can run on any thread,
+    // handleResult() asks the user whether to load invalid data anyway
+    static Result check(const muse::String& name, const muse::ByteArray& data);
+    static engraving::Err handleResult(const muse::String& name, const Result& result);
 };
 }
@@ -36,6 +36,7 @@ static const Settings::Key MUSICXML_EXPORT_LAYOUT_KEY(module_name, "export/music
 static const Settings::Key MUSICXML_EXPORT_MU3_COMPAT_KEY(module_name, "export/musicXml/exportMu3Compat");
 static const Settings::Key MUSICXML_EXPORT_BREAKS_TYPE_KEY(module_name, "export/musicXml/exportBreaks");
 static const Settings::Key MUSICXML_EXPORT_INVISIBLE_ELEMENTS_KEY(module_name, "export/musicXml/exportInvisibleElements");
+static const Settings::Key MUSICXML_EXPORT_PARALLEL_KEY(module_name, "export/musicXml/exportParallel");
 static const Settings::Key MIGRATION_APPLY_EDWIN_FOR_XML(module_name, "import/compatibility/apply_edwin_for_xml");
 static const Settings::Key MIGRATION_NOT_ASK_AGAIN_KEY(module_name, "import/compatibility/do_not_ask_me_again");
 static const Settings::Key MUSICXML_IMPORT_INFER_TEXT_TYPE(module_name, "import/musicXml/importInferTextType");
@@ -64,6 +65,7 @@ void MusicXmlConfiguration::init()
     settings()->setDescription(MUSICXML_EXPORT_INVISIBLE_ELEMENTS_KEY,
                                muse::trc("iex_musicxml", "Export invisible elements to MusicXML"));
     settings()->setCanBeManuallyEdited(MUSICXML_EXPORT_INVISIBLE_ELEMENTS_KEY, true);
+    settings()->setDefaultValue(MUSICXML_EXPORT_PARALLEL_KEY, Val(false));
 
     settings()->setDefaultValue(MIGRATION_APPLY_EDWIN_FOR_XML, Val(false));
     settings()->valueChanged(MIGRATION_APPLY_EDWIN_FOR_XML).onReceive(this, [this](const Val& val) {
@@ -151,6 +153,16 @@ void MusicXmlConfiguration::setExportInvisibleElements(bool value)
     settings()->setSharedValue(MUSICXML_EXPORT_INVISIBLE_ELEMENTS_KEY, Val(value));
 }
 
+bool MusicXmlConfiguration::exportParallel() const
+{
+    return settings()->value(MUSICXML_EXPORT_PARALLEL_KEY).toBool();
+}
+
+void MusicXmlConfiguration::setExportParallel(bool value)
+{
+    settings()->setSharedValue(MUSICXML_EXPORT_PARALLEL_KEY, Val(value));
+}
+
 bool MusicXmlConfiguration::needUseDefaultFont() const
 {
     if (m_needUseDefaultFontOverride.has_value()) {
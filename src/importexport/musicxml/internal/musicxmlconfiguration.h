@@ -50,6 +50,9 @@ public:
     bool exportInvisibleElements() const override;
     void setExportInvisibleElements(bool value) override;
 
+    bool exportParallel() const override;
+    void setExportParallel(bool value) override;
+
     bool needUseDefaultFont() const override;
     void setNeedUseDefaultFont(bool value) override;
     muse::async::Channel<bool> needUseDefaultFontChanged() const override;
@@ -61,8 +61,8 @@ void MusicXmlModule::resolveImports()
 
     auto writers = globalIoc()->resolve<INotationWritersRegister>(moduleName());
     if (writers) {
-        writers->reg({ "musicxml", "xml" }, std::make_shared<MusicXmlWriter>());
-        writers->reg({ "mxl" }, std::make_shared<MxlWriter>());
+        writers->reg({ "musicxml", "xml" }, []() { return std::make_shared<MusicXmlWriter>(); });
+        writers->reg({ "mxl" }, []() { return std::make_shared<MxlWriter>(); });
     }
 #endif
 }
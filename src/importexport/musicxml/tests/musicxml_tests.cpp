@@ -56,11 +56,13 @@ static const std::string PREF_IMPORT_MUSICXML_IMPORTBREAKS("import/musicXml/impo
 static const std::string PREF_IMPORT_MUSICXML_INFERTEXT("import/musicXml/importInferTextType");
 static const std::string PREF_EXPORT_MUSICXML_EXPORTLAYOUT("export/musicXml/exportLayout");
 static const std::string PREF_EXPORT_MUSICXML_EXPORTINVISIBLE("export/musicXml/exportInvisibleElements");
+static const std::string PREF_EXPORT_MUSICXML_EXPORTPARALLEL("export/musicXml/exportParallel");
 
 class MusicXml_Tests : public ::testing::Test
 {
 public:
     void musicXmlIoTest(const char* file, bool exportLayout = false);
+    void musicXmlIoTestParallel(const char* file);
     void musicXmlIoTestRef(const char* file);
     void musicXmlIoTestRefBreaks(const char* file);
     void musicXmlMscxExportTestRef(const char* file, bool exportLayout = false);
@@ -69,11 +71,19 @@ public:
     void musicXmlReadTestCompr(const char* file);
     void musicXmlReadWriteTestCompr(const char* file);
     void musicXmlImportTestRef(const char* file);
+    void musicXmlValidateAndImportTest(const char* file);
 
     void setValue(const std::string& key, const Val& value);
 
     MasterScore* readScore(const String& fileName, bool isAbsolutePath = false);
     bool saveCompareMusicXmlScore(MasterScore* score, const String& saveName, const String& compareWith);
+
+protected:
+    void TearDown() override
+    {
+        // a parallel export test may stop at a failed assertion
+        setValue(PREF_EXPORT_MUSICXML_EXPORTPARALLEL, Val(false));
+    }
 };
 
 //---------------------------------------------------------
@@ -144,6 +154,17 @@ void MusicXml_Tests::musicXmlIoTest(const char* file, bool exportLayout)
     delete score;
 }
 
+//---------------------------------------------------------
+//   musicXmlIoTestParallel
+//   same as musicXmlIoTest, but write the parts concurrently
+//---------------------------------------------------------
+
+void MusicXml_Tests::musicXmlIoTestParallel(const char* file)
+{
+    setValue(PREF_EXPORT_MUSICXML_EXPORTPARALLEL, Val(true));
+    musicXmlIoTest(file);
+}
+
 //---------------------------------------------------------
 //   musicXmlIoTestRef
 //   read a MusicXML file, write to a new file and verify against reference
@@ -366,6 +387,40 @@ void MusicXml_Tests::musicXmlImportTestRef(const char* file)
     delete score;
 }
 
+//---------------------------------------------------------
+//   musicXmlValidateAndImportTest
+//   read a MusicXML file with validation running next to pass 1 and without validation,
+//   and verify both scores are identical
+//---------------------------------------------------------
+
+void MusicXml_Tests::musicXmlValidateAndImportTest(const char* file)
+{
+    MScore::debugMode = false;
+    setValue(PREF_IMPORT_MUSICXML_INFERTEXT, Val(true));
+
+    auto importForced = [](MasterScore* score, const muse::io::path_t& path) -> engraving::Err {
+        return importMusicXml(score, path.toQString(), true);
+    };
+
+    String fileName = String::fromUtf8(file);
+    MasterScore* score = readScore(XML_IO_DATA_DIR + fileName + u".xml");
+    ASSERT_TRUE(score);
+    MasterScore* forcedScore = ScoreRW::readScore(XML_IO_DATA_DIR + fileName + u".xml", false, importForced);
+    if (!forcedScore) {
+        delete score;
+        FAIL() << "forced import failed";
+    }
+    fixupScore(score);
+    fixupScore(forcedScore);
+    score->doLayout();
+    forcedScore->doLayout();
+    EXPECT_TRUE(ScoreRW::saveScore(score, fileName + u".mscx"));
+    EXPECT_TRUE(ScoreRW::saveScore(forcedScore, fileName + u"_forced.mscx"));
+    EXPECT_TRUE(ScoreComp::compareFiles(fileName + u".mscx", fileName + u"_forced.mscx"));
+    delete score;
+    delete forcedScore;
+}
+
 TEST_F(MusicXml_Tests, accidentals1) {
     musicXmlIoTest("testAccidentals1");
 }
@@ -738,6 +793,9 @@ TEST_F(MusicXml_Tests, helloReadCompr) {
 TEST_F(MusicXml_Tests, helloReadWriteCompr) {
     musicXmlReadWriteTestCompr("testHello");
 }
+TEST_F(MusicXml_Tests, helloValidateAndImport) {
+    musicXmlValidateAndImportTest("testHello");
+}
 TEST_F(MusicXml_Tests, holes) {
     musicXmlIoTest("testHoles");
 }
@@ -1068,6 +1126,15 @@ TEST_F(MusicXml_Tests, pageNumbers4) {
 TEST_F(MusicXml_Tests, pageNumbers5) {
     musicXmlMscxExportTestRefBreaks("testPageNumbers5");
 }
+TEST_F(MusicXml_Tests, parallelExportGroupTime) {
+    musicXmlIoTestParallel("testGroupTime2");
+}
+TEST_F(MusicXml_Tests, parallelExportPlaytech) {
+    musicXmlIoTestParallel("testPlaytech");
+}
+TEST_F(MusicXml_Tests, parallelExportTrackHandling) {
+    musicXmlIoTestParallel("testTrackHandling");
+}
 TEST_F(MusicXml_Tests, partNames) {
     musicXmlImportTestRef("testPartNames");
 }
@@ -1380,6 +1447,9 @@ TEST_F(MusicXml_Tests, unusualDurations) {
 TEST_F(MusicXml_Tests, unterminatedTies) {
     musicXmlImportTestRef("testUnterminatedTies");
 }
+TEST_F(MusicXml_Tests, validationError) {
+    musicXmlValidateAndImportTest("testValidationError");
+}
 TEST_F(MusicXml_Tests, virtualInstruments) {
     musicXmlIoTestRef("testVirtualInstruments");
 }
@@ -45,7 +45,10 @@ void ExcerptNotation::init()
         return;
     }
 
-    setScore(m_excerpt->excerptScore());
+    //! NOTE The part score of a deferred excerpt is read when it is first needed, see score()
+    if (!m_excerpt->isDeferred()) {
+        setScore(m_excerpt->excerptScore());
+    }
 
     m_inited = true;
 }
@@ -75,6 +78,27 @@ bool ExcerptNotation::isEmpty() const
     return m_excerpt->parts().empty();
 }
 
+bool ExcerptNotation::isOpen() const
+{
+    // deferred part scores are never open, see MscLoader
+    if (m_excerpt->isDeferred()) {
+        return false;
+    }
+
+    return Notation::isOpen();
+}
+
+mu::engraving::Score* ExcerptNotation::score() const
+{
+    if (m_inited && !Notation::score()) {
+        if (mu::engraving::Score* excerptScore = m_excerpt->ensureExcerptLoaded()) {
+            const_cast<ExcerptNotation*>(this)->setScore(excerptScore);
+        }
+    }
+
+    return Notation::score();
+}
+
 mu::engraving::Excerpt* ExcerptNotation::excerpt() const
 {
     return m_excerpt;
@@ -137,6 +161,8 @@ INotationPtr ExcerptNotation::notation()
 
 IExcerptNotationPtr ExcerptNotation::clone() const
 {
+    m_excerpt->ensureExcerptLoaded();
+
     mu::engraving::Excerpt* copy = new mu::engraving::Excerpt(*m_excerpt);
     copy->markAsCustom();
 
@@ -42,6 +42,8 @@ public:
     bool isCustom() const override;
     bool isEmpty() const override;
 
+    bool isOpen() const override;
+
     QString name() const override;
     void setName(const QString& name) override;
     void undoSetName(const QString& name) override;
@@ -53,6 +55,9 @@ public:
     INotationPtr notation() override;
     IExcerptNotationPtr clone() const override;
 
+protected:
+    mu::engraving::Score* score() const override;
+
 private:
     mu::engraving::Excerpt* m_excerpt = nullptr;
     bool m_inited = false;
@@ -0,0 +1,193 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "hittestcache.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "engraving/dom/page.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace mu::engraving;
+using namespace mu::notation;
+
+static constexpr int MAX_GRID_DIMENSION = 256;
+static constexpr double ITEMS_PER_CELL = 4.0;
+
+void HitTestCache::clear()
+{
+    m_page = nullptr;
+    m_layoutGeneration = 0;
+    m_entries.clear();
+    m_cells.clear();
+    m_visitStamps.clear();
+    m_gridRect = RectF();
+    m_columns = 0;
+    m_rows = 0;
+    m_found.clear();
+    m_lastHits = LastHits();
+}
+
+const std::vector<const HitTestCache::Entry*>& HitTestCache::entries(Page* page, const RectF& rect)
+{
+    m_found.clear();
+
+    if (page != m_page || page->layoutGeneration() != m_layoutGeneration) {
+        build(page);
+    }
+
+    if (m_entries.empty()) {
+        return m_found;
+    }
+
+    // an entry can be in several cells
+    if (++m_visitStamp == 0) {
+        std::fill(m_visitStamps.begin(), m_visitStamps.end(), 0);
+        m_visitStamp = 1;
+    }
+
+    int x1, y1, x2, y2;
+    cellRange(rect, x1, y1, x2, y2);
+
+    for (int y = y1; y <= y2; ++y) {
+        for (int x = x1; x <= x2; ++x) {
+            for (uint32_t idx : m_cells[y * m_columns + x]) {
+                if (m_visitStamps[idx] == m_visitStamp) {
+                    continue;
+                }
+                m_visitStamps[idx] = m_visitStamp;
+
+                const Entry& entry = m_entries[idx];
+                if (entry.hitBBox.intersects(rect)) {
+                    m_found.push_back(&entry);
+                }
+            }
+        }
+    }
+
+    return m_found;
+}
+
+bool HitTestCache::findHits(Page* page, const PointF& pos, double width, Hits& hits)
+{
+    if (!m_lastHits.valid || page != m_page || m_lastHits.pos != pos || m_lastHits.width != width) {
+        return false;
+    }
+
+    if (page->layoutGeneration() != m_layoutGeneration) {
+        return false;
+    }
+
+    hits = m_lastHits.hits;
+    return true;
+}
+
+void HitTestCache::setHits(const Page* page, const PointF& pos, double width, const Hits& hits)
+{
+    IF_ASSERT_FAILED(page == m_page) {
+        return;
+    }
+
+    m_lastHits.pos = pos;
+    m_lastHits.width = width;
+    m_lastHits.hits = hits;
+    m_lastHits.valid = true;
+}
+
+void HitTestCache::build(Page* page)
+{
+    TRACEFUNC;
+
+    clear();
+
+    m_page = page;
+    m_layoutGeneration = page->layoutGeneration();
+
+    const std::vector<Page::DisplayItem>& displayList = page->displayList();
+    m_entries.reserve(displayList.size());
+
+    for (const Page::DisplayItem& di : displayList) {
+        EngravingItem* item = di.item;
+        if (item->isPage()) {
+            continue;
+        }
+
+        Entry entry;
+        entry.item = item;
+        entry.hitShape = item->hitShape().translated(item->pagePos());
+        entry.hitBBox = entry.hitShape.bbox();
+        if (entry.hitShape.empty()) {
+            continue;
+        }
+
+        m_gridRect.unite(entry.hitBBox);
+        m_entries.push_back(std::move(entry));
+    }
+
+    if (m_entries.empty()) {
+        return;
+    }
+
+    // about ITEMS_PER_CELL items in a cell if they were evenly spread
+    double cellArea = m_gridRect.width() * m_gridRect.height() * ITEMS_PER_CELL / static_cast<double>(m_entries.size());
+    double cellSize = std::max(std::sqrt(cellArea), 1.0);
+
+    m_columns = std::clamp(static_cast<int>(std::ceil(m_gridRect.width() / cellSize)), 1, MAX_GRID_DIMENSION);
+    m_rows = std::clamp(static_cast<int>(std::ceil(m_gridRect.height() / cellSize)), 1, MAX_GRID_DIMENSION);
+    m_cellWidth = std::max(m_gridRect.width() / m_columns, 1.0);
+    m_cellHeight = std::max(m_gridRect.height() / m_rows, 1.0);
+
+    m_cells.assign(static_cast<size_t>(m_columns * m_rows), std::vector<uint32_t>());
+    m_visitStamps.assign(m_entries.size(), 0);
+
+    for (uint32_t idx = 0; idx < m_entries.size(); ++idx) {
+        int x1, y1, x2, y2;
+        cellRange(m_entries[idx].hitBBox, x1, y1, x2, y2);
+
+        for (int y = y1; y <= y2; ++y) {
+            for (int x = x1; x <= x2; ++x) {
+                m_cells[y * m_columns + x].push_back(idx);
+            }
+        }
+    }
+}
+
+void HitTestCache::cellRange(const RectF& rect, int& x1, int& y1, int& x2, int& y2) const
+{
+    auto cell = [](double offset, double cellSize, int count) {
+        double idx = std::floor(offset / cellSize);
+        return static_cast<int>(std::clamp(idx, 0.0, static_cast<double>(count - 1)));
+    };
+    auto column = [&](double x) {
+        return cell(x - m_gridRect.left(), m_cellWidth, m_columns);
+    };
+    auto row = [&](double y) {
+        return cell(y - m_gridRect.top(), m_cellHeight, m_rows);
+    };
+
+    x1 = column(rect.left());
+    x2 = column(rect.right());
+    y1 = row(rect.top());
+    y2 = row(rect.bottom());
+}
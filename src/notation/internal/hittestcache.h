@@ -0,0 +1,97 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <vector>
+
+#include "draw/types/geometry.h"
+#include "engraving/infrastructure/shape.h"
+
+namespace mu::engraving {
+class EngravingItem;
+class Page;
+}
+
+namespace mu::notation {
+//---------------------------------------------------------
+//   HitTestCache
+//    Hit shapes of the items of a page in page coordinates,
+//    bucketed into a uniform grid. Built on the first query
+//    after a layout of the page and reused until the next one,
+//    so hover and drag don't have to compute the shapes again.
+//---------------------------------------------------------
+
+class HitTestCache
+{
+public:
+    struct Entry {
+        engraving::EngravingItem* item = nullptr;
+        muse::RectF hitBBox;
+        engraving::Shape hitShape;
+    };
+
+    //! NOTE Only the geometry is cached, the hits still have to be filtered
+    //! and ordered by the state of the items, e.g. whether they are visible
+    struct Hits {
+        std::vector<engraving::EngravingItem*> containing;     // hit shape contains the position
+        std::vector<engraving::EngravingItem*> intersecting;   // hit shape intersects the hit rect
+    };
+
+    void clear();
+
+    //! NOTE Entries whose hit bbox intersects rect, the entries
+    //! stay valid until the next query for another page or layout
+    const std::vector<const Entry*>& entries(engraving::Page* page, const muse::RectF& rect);
+
+    //! NOTE The hits of the last query, if the page wasn't updated since
+    bool findHits(engraving::Page* page, const muse::PointF& pos, double width, Hits& hits);
+    void setHits(const engraving::Page* page, const muse::PointF& pos, double width, const Hits& hits);
+
+private:
+    void build(engraving::Page* page);
+    void cellRange(const muse::RectF& rect, int& x1, int& y1, int& x2, int& y2) const;
+
+    engraving::Page* m_page = nullptr;
+    uint64_t m_layoutGeneration = 0;
+
+    std::vector<Entry> m_entries;
+    std::vector<std::vector<uint32_t> > m_cells;
+    std::vector<uint32_t> m_visitStamps;
+    uint32_t m_visitStamp = 0;
+    muse::RectF m_gridRect;
+    int m_columns = 0;
+    int m_rows = 0;
+    double m_cellWidth = 0.0;
+    double m_cellHeight = 0.0;
+
+    std::vector<const Entry*> m_found;
+
+    struct LastHits {
+        muse::PointF pos;
+        double width = 0.0;
+        Hits hits;
+        bool valid = false;
+    };
+
+    LastHits m_lastHits;
+};
+}
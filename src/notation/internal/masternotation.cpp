@@ -639,7 +639,8 @@ void MasterNotation::updateExcerpts()
         }
 
         IExcerptNotationPtr excerptNotation = createAndInitExcerptNotation(this, excerpt, iocContext());
-        bool open = excerpt->excerptScore()->isOpen();
+        // deferred part scores are never open, see MscLoader
+        bool open = excerpt->excerptScore() && excerpt->excerptScore()->isOpen();
         if (open) {
             excerptNotation->notation()->elements()->msScore()->doLayout();
         }
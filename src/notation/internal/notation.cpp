@@ -148,23 +148,23 @@ muse::async::Notification Notation::scoreInited() const
 
 QString Notation::name() const
 {
-    return m_score ? m_score->name().toQString() : QString();
+    return score() ? score()->name().toQString() : QString();
 }
 
 QString Notation::projectName() const
 {
-    return m_score ? m_score->masterScore()->name().toQString() : QString();
+    return score() ? score()->masterScore()->name().toQString() : QString();
 }
 
 QString Notation::projectNameAndPartName() const
 {
-    if (!m_score) {
+    if (!score()) {
         return QString();
     }
 
-    QString result = m_score->masterScore()->name();
-    if (!m_score->isMaster()) {
-        result += " - " + m_score->name().toQString();
+    QString result = score()->masterScore()->name();
+    if (!score()->isMaster()) {
+        result += " - " + score()->name().toQString();
     }
 
     return result;
@@ -172,13 +172,13 @@ QString Notation::projectNameAndPartName() const
 
 QString Notation::workTitle() const
 {
-    if (!m_score) {
+    if (!score()) {
         return QString();
     }
 
-    QString workTitle = m_score->metaTag(u"workTitle");
+    QString workTitle = score()->metaTag(u"workTitle");
     if (workTitle.isEmpty()) {
-        return m_score->masterScore()->name();
+        return score()->masterScore()->name();
     }
 
     return workTitle;
@@ -186,13 +186,13 @@ QString Notation::workTitle() const
 
 QString Notation::projectWorkTitle() const
 {
-    if (!m_score) {
+    if (!score()) {
         return QString();
     }
 
-    QString workTitle = m_score->masterScore()->metaTag(u"workTitle");
+    QString workTitle = score()->masterScore()->metaTag(u"workTitle");
     if (workTitle.isEmpty()) {
-        return m_score->masterScore()->name();
+        return score()->masterScore()->name();
     }
 
     return workTitle;
@@ -200,12 +200,12 @@ QString Notation::projectWorkTitle() const
 
 QString Notation::projectWorkTitleAndPartName() const
 {
-    if (!m_score) {
+    if (!score()) {
         return QString();
     }
 
     QString result = projectWorkTitle();
-    if (!m_score->isMaster()) {
+    if (!score()->isMaster()) {
         result += " - " + name();
     }
 
@@ -255,7 +255,7 @@ bool Notation::hasVisibleParts() const
 
 bool Notation::isMaster() const
 {
-    return m_score->isMaster();
+    return score()->isMaster();
 }
 
 void Notation::notifyAboutNotationChanged(const muse::RectF& updateRect)
@@ -706,9 +706,22 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
         }
     }
 
-    RectF hitRect(posOnPage.x() - width, posOnPage.y() - width, 3.0 * width, 3.0 * width);
+    HitTestCache::Hits hits;
+    if (!m_hitTestCache.findHits(page, posOnPage, width, hits)) {
+        RectF hitRect(posOnPage.x() - width, posOnPage.y() - width, 3.0 * width, 3.0 * width);
 
-    std::vector<EngravingItem*> potentiallyHitElements = page->items(hitRect);
+        for (const HitTestCache::Entry* entry : m_hitTestCache.entries(page, hitRect)) {
+            if (entry->hitShape.contains(posOnPage)) {
+                hits.containing.push_back(entry->item);
+            }
+
+            if (entry->hitShape.intersects(hitRect)) {
+                hits.intersecting.push_back(entry->item);
+            }
+        }
+
+        m_hitTestCache.setHits(page, posOnPage, width, hits);
+    }
 
     auto canHitElement = [](const EngravingItem* element) {
         if (!element->selectable() || element->isPage()) {
@@ -724,15 +737,9 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
         return true;
     };
 
-    for (EngravingItem* element : potentiallyHitElements) {
-        element->itemDiscovered = 0;
-
-        if (!canHitElement(element)) {
-            continue;
-        }
-
-        if (element->hitShapeContains(posOnPage)) {
-            hitElements.push_back(element);
+    for (EngravingItem* item : hits.containing) {
+        if (canHitElement(item)) {
+            hitElements.push_back(item);
         }
     }
 
@@ -740,13 +747,9 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
         //
         // if no relevant element hit, look nearby
         //
-        for (EngravingItem* element : potentiallyHitElements) {
-            if (!canHitElement(element)) {
-                continue;
-            }
-
-            if (element->hitShapeIntersects(hitRect)) {
-                hitElements.push_back(element);
+        for (EngravingItem* item : hits.intersecting) {
+            if (canHitElement(item)) {
+                hitElements.push_back(item);
             }
         }
     }
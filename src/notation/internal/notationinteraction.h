@@ -44,6 +44,7 @@
 #include "engraving/dom/elementgroup.h"
 #include "engraving/rendering/paintoptions.h"
 #include "engraving/types/symid.h"
+#include "hittestcache.h"
 #include "previewmeasure.h"
 #include "scorecallbacks.h"
 
@@ -577,6 +578,7 @@ private:
 
     bool m_notifyAboutDropChanged = false;
     HitElementContext m_hitElementContext;
+    mutable HitTestCache m_hitTestCache;
 
     muse::async::Channel<ShowItemRequest> m_showItemRequested;
 
@@ -94,8 +94,9 @@ void NotationStyle::applyToAllParts()
     mu::engraving::MStyle style = m_getScore->score()->style();
 
     for (mu::engraving::Excerpt* excerpt : score()->masterScore()->excerpts()) {
-        excerpt->excerptScore()->undo(new mu::engraving::ChangeStyle(excerpt->excerptScore(), style));
-        excerpt->excerptScore()->update();
+        mu::engraving::Score* excerptScore = excerpt->ensureExcerptLoaded();
+        excerptScore->undo(new mu::engraving::ChangeStyle(excerptScore, style));
+        excerptScore->update();
     }
 }
 
@@ -61,10 +61,10 @@ void NotationModule::resolveImports()
 {
     auto writers = globalIoc()->resolve<project::INotationWritersRegister>(mname);
     if (writers) {
-        writers->reg({ "spos" }, std::make_shared<PositionsWriter>(PositionsWriter::ElementType::SEGMENT));
-        writers->reg({ "mpos" }, std::make_shared<PositionsWriter>(PositionsWriter::ElementType::MEASURE));
-        writers->reg({ "mscz" }, std::make_shared<MscNotationWriter>(engraving::MscIoMode::Zip));
-        writers->reg({ "mscx" }, std::make_shared<MscNotationWriter>(engraving::MscIoMode::Dir));
+        writers->reg({ "spos" }, []() { return std::make_shared<PositionsWriter>(PositionsWriter::ElementType::SEGMENT); });
+        writers->reg({ "mpos" }, []() { return std::make_shared<PositionsWriter>(PositionsWriter::ElementType::MEASURE); });
+        writers->reg({ "mscz" }, []() { return std::make_shared<MscNotationWriter>(engraving::MscIoMode::Zip); });
+        writers->reg({ "mscx" }, []() { return std::make_shared<MscNotationWriter>(engraving::MscIoMode::Dir); });
     }
 }
 
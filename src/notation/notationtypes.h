@@ -442,6 +442,26 @@ struct TransposeOptions
     bool needTransposeKeys = false;
     bool needTransposeChordNames = false;
     bool needTransposeDoubleSharpsFlats = false;
+
+    bool operator==(const TransposeOptions& options) const
+    {
+        bool equals = true;
+
+        equals &= mode == options.mode;
+        equals &= direction == options.direction;
+        equals &= key == options.key;
+        equals &= interval == options.interval;
+        equals &= needTransposeKeys == options.needTransposeKeys;
+        equals &= needTransposeChordNames == options.needTransposeChordNames;
+        equals &= needTransposeDoubleSharpsFlats == options.needTransposeDoubleSharpsFlats;
+
+        return equals;
+    }
+
+    bool operator!=(const TransposeOptions& options) const
+    {
+        return !(*this == options);
+    }
 };
 
 struct TupletOptions
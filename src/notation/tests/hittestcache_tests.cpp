@@ -0,0 +1,218 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2026 MuseScore Limited and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/page.h"
+
+#include "engraving/tests/utils/scorerw.h"
+
+#include "notation/internal/hittestcache.h"
+
+using namespace mu::engraving;
+using namespace mu::notation;
+
+static const String HITTESTCACHE_DATA_DIR(u"hittestcache_data/");
+
+class Notation_HitTestCacheTests : public ::testing::Test
+{
+};
+
+static std::set<EngravingItem*> foundItems(const std::vector<const HitTestCache::Entry*>& entries)
+{
+    std::set<EngravingItem*> items;
+    for (const HitTestCache::Entry* entry : entries) {
+        items.insert(entry->item);
+    }
+    return items;
+}
+
+static EngravingItem* firstNote(Page* page)
+{
+    for (const Page::DisplayItem& di : page->displayList()) {
+        if (di.item->isNote()) {
+            return di.item;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Notation_HitTestCacheTests_Entries
+ * @details The entries found for a rect are the page items whose hit shape intersects it
+ */
+TEST_F(Notation_HitTestCacheTests, Entries)
+{
+    MasterScore* score = ScoreRW::readScore(HITTESTCACHE_DATA_DIR + u"hittestcache.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    ASSERT_TRUE(page);
+
+    // [GIVEN] The top left quarter of the page
+    RectF rect = page->pageBoundingRect();
+    rect.setWidth(rect.width() / 2);
+    rect.setHeight(rect.height() / 2);
+
+    // [WHEN] The entries for the rect are found
+    HitTestCache cache;
+    std::set<EngravingItem*> found = foundItems(cache.entries(page, rect));
+
+    // [THEN] They are the items whose hit shape intersects the rect
+    std::set<EngravingItem*> expected;
+    for (const Page::DisplayItem& di : page->displayList()) {
+        EngravingItem* item = di.item;
+        if (item->isPage()) {
+            continue;
+        }
+
+        Shape hitShape = item->hitShape().translated(item->pagePos());
+        if (!hitShape.empty() && hitShape.bbox().intersects(rect)) {
+            expected.insert(item);
+        }
+    }
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(found, expected);
+
+    delete score;
+}
+
+/**
+ * @brief Notation_HitTestCacheTests_InvalidatedByLayout
+ * @details The entries are built again when the layout generation of the page changes
+ */
+TEST_F(Notation_HitTestCacheTests, InvalidatedByLayout)
+{
+    MasterScore* score = ScoreRW::readScore(HITTESTCACHE_DATA_DIR + u"hittestcache.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    ASSERT_TRUE(page);
+
+    EngravingItem* note = firstNote(page);
+    ASSERT_TRUE(note);
+
+    // [GIVEN] A cache built for the page
+    HitTestCache cache;
+    const RectF pageRect = page->pageBoundingRect();
+    EXPECT_TRUE(foundItems(cache.entries(page, pageRect)).count(note));
+
+    // [WHEN] A note is moved to an empty place without updating the page
+    const RectF emptyRect(pageRect.right() - 10.0, pageRect.bottom() - 10.0, 5.0, 5.0);
+    EXPECT_TRUE(cache.entries(page, emptyRect).empty());
+
+    note->move(emptyRect.center() - note->pageBoundingRect().center());
+
+    // [THEN] The cached entries are still used
+    EXPECT_TRUE(cache.entries(page, emptyRect).empty());
+
+    // [WHEN] The page is updated
+    const uint64_t generation = page->layoutGeneration();
+    page->invalidateBspTree();
+    EXPECT_NE(page->layoutGeneration(), generation);
+
+    // [THEN] The entries are built again
+    EXPECT_TRUE(foundItems(cache.entries(page, emptyRect)).count(note));
+
+    delete score;
+}
+
+/**
+ * @brief Notation_HitTestCacheTests_InvalidatedByItemUpdate
+ * @details The entries are built again when a single item of the page is updated without a relayout
+ */
+TEST_F(Notation_HitTestCacheTests, InvalidatedByItemUpdate)
+{
+    MasterScore* score = ScoreRW::readScore(HITTESTCACHE_DATA_DIR + u"hittestcache.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    ASSERT_TRUE(page);
+
+    EngravingItem* note = firstNote(page);
+    ASSERT_TRUE(note);
+
+    // [GIVEN] A cache built for the page
+    HitTestCache cache;
+    const RectF pageRect = page->pageBoundingRect();
+    const RectF emptyRect(pageRect.right() - 10.0, pageRect.bottom() - 10.0, 5.0, 5.0);
+    EXPECT_TRUE(cache.entries(page, emptyRect).empty());
+
+    // [WHEN] A note is moved and only the note is updated in the page
+    note->move(emptyRect.center() - note->pageBoundingRect().center());
+
+    const uint64_t generation = page->layoutGeneration();
+    page->updateBspItem(note);
+    EXPECT_NE(page->layoutGeneration(), generation);
+
+    // [THEN] The entries are built again
+    EXPECT_TRUE(foundItems(cache.entries(page, emptyRect)).count(note));
+
+    delete score;
+}
+
+/**
+ * @brief Notation_HitTestCacheTests_Hits
+ * @details The last hits are found for the same page, position and width until the page is updated
+ */
+TEST_F(Notation_HitTestCacheTests, Hits)
+{
+    MasterScore* score = ScoreRW::readScore(HITTESTCACHE_DATA_DIR + u"hittestcache.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    ASSERT_TRUE(page);
+
+    EngravingItem* note = firstNote(page);
+    ASSERT_TRUE(note);
+
+    HitTestCache cache;
+    const PointF pos = note->pageBoundingRect().center();
+    const double width = 2.0;
+    HitTestCache::Hits hits;
+
+    // [GIVEN] No hits yet
+    EXPECT_FALSE(cache.findHits(page, pos, width, hits));
+
+    // [WHEN] Hits are stored
+    cache.entries(page, RectF(pos.x(), pos.y(), width, width));
+    cache.setHits(page, pos, width, { { note }, { note } });
+
+    // [THEN] They are found for the same query only
+    ASSERT_TRUE(cache.findHits(page, pos, width, hits));
+    EXPECT_EQ(hits.containing, std::vector<EngravingItem*>({ note }));
+    EXPECT_EQ(hits.intersecting, std::vector<EngravingItem*>({ note }));
+    EXPECT_FALSE(cache.findHits(page, pos + PointF(1.0, 0.0), width, hits));
+    EXPECT_FALSE(cache.findHits(page, pos, width * 2, hits));
+
+    // [WHEN] The page is updated
+    page->invalidateBspTree();
+
+    // [THEN] The hits aren't found anymore
+    EXPECT_FALSE(cache.findHits(page, pos, width, hits));
+
+    delete score;
+}
@@ -339,7 +339,7 @@ void PageSettings::applyToAllParts()
         return;
     }
     for (Excerpt* e : score()->masterScore()->excerpts()) {
-        applyToScore(e->excerptScore());
+        applyToScore(e->ensureExcerptLoaded());
     }
     _changeFlag = false;
 }
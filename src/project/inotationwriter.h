@@ -49,7 +49,8 @@ public:
         UNIT_TYPE,
         PAGE_NUMBER,
         TRANSPARENT_BACKGROUND,
-        BEATS_COLORS
+        BEATS_COLORS,
+        STREAM_TO_DEVICE // write to the device while exporting instead of at once, if the writer supports it
     };
 
     using Options = std::map<OptionKey, muse::Val>;
@@ -23,6 +23,8 @@
 #ifndef MU_PROJECT_INOTATIONWRITERSREGISTER_H
 #define MU_PROJECT_INOTATIONWRITERSREGISTER_H
 
+#include <functional>
+
 #include "modularity/imoduleinterface.h"
 #include "inotationwriter.h"
 
@@ -34,8 +36,15 @@ class INotationWritersRegister : MODULE_GLOBAL_INTERFACE
 public:
     virtual ~INotationWritersRegister() = default;
 
+    using WriterCreator = std::function<INotationWriterPtr()>;
+
     virtual void reg(const std::vector<std::string>& suffixes, INotationWriterPtr writer) = 0;
+    virtual void reg(const std::vector<std::string>& suffixes, const WriterCreator& creator) = 0;
     virtual INotationWriterPtr writer(const std::string& suffix) const = 0;
+
+    //! NOTE Returns a writer of its own for one export, e.g. when several exports run in parallel.
+    //! Only writers registered with a creator can be created, otherwise returns nullptr
+    virtual INotationWriterPtr newWriter(const std::string& suffix) const = 0;
 };
 }
 
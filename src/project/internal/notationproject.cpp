@@ -21,6 +21,7 @@
  */
 #include "notationproject.h"
 
+#include <chrono>
 #include <memory>
 
 #include <QBuffer>
@@ -665,6 +666,12 @@ Ret NotationProject::doSave(const muse::io::path_t& path, engraving::MscIoMode i
         }
     }
 
+#ifdef MUSE_THREADS_SUPPORT
+    if (isAutosave && ioMode != MscIoMode::Dir) {
+        return autoSaveInBackground(path, ioMode);
+    }
+#endif
+
     // Step 2: write project
     {
         MscWriter::Params params;
@@ -704,35 +711,6 @@ Ret NotationProject::doSave(const muse::io::path_t& path, engraving::MscIoMode i
         }
 
         if (maybeOutBuf) {
-#ifdef MUSE_THREADS_SUPPORT
-            if (isAutosave) {
-                // For autosave, write to disk on a background thread to avoid stuttering.
-                // The buffer is fully serialized at this point so it's safe to move off the main thread.
-                muse::ByteArray data = maybeOutBuf->data();
-                QString savePathCopy = savePath;
-                QString targetContainerPathCopy = targetContainerPath;
-                muse::io::path_t targetMainFilePathCopy = targetMainFilePath;
-                auto fs = fileSystem();
-                Concurrent::run([fs, savePathCopy, targetContainerPathCopy, targetMainFilePathCopy, data]() {
-                    Ret writeRet = fs->writeFile(savePathCopy, data);
-                    if (!writeRet) {
-                        LOGE() << "Autosave: failed to write project file: " << writeRet.toString();
-                        return;
-                    }
-                    Ret copyRet = fs->copy(savePathCopy, targetContainerPathCopy, true);
-                    if (!copyRet) {
-                        LOGE() << "Autosave: failed to copy to target: " << copyRet.toString();
-                        return;
-                    }
-                    fs->remove(savePathCopy);
-                    QFile::setPermissions(targetMainFilePathCopy.toQString(),
-                                          QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
-                    LOGD() << "Autosave: background write complete: " << targetContainerPathCopy;
-                });
-                return make_ret(Ret::Code::Ok);
-            }
-#endif
-
             ret = fileSystem()->writeFile(savePath, maybeOutBuf->data());
             if (!ret) {
                 LOGE() << "Failed to write project file";
@@ -810,6 +788,94 @@ Ret NotationProject::doSave(const muse::io::path_t& path, engraving::MscIoMode i
     return make_ret(Ret::Code::Ok);
 }
 
+//! NOTE Only the serialization into XML buffers touches the score, so only
+//! this part is done on the main thread. Compression, writing and replacing
+//! the target file is done on a background thread.
+Ret NotationProject::autoSaveInBackground(const muse::io::path_t& path, engraving::MscIoMode ioMode)
+{
+    TRACEFUNC;
+
+    using clock = std::chrono::steady_clock;
+
+    if (m_autoSaveInProgress->load()) {
+        return make_ret(Ret::Code::Cancel);
+    }
+
+    QString targetContainerPath = engraving::containerPath(path).toQString();
+    muse::io::path_t targetMainFilePath = engraving::mainFilePath(path);
+    QString savePath = targetContainerPath + "_saving";
+
+    MscWriter::Params params;
+    params.filePath = savePath;
+    params.mainFileName = engraving::mainFileName(path).toQString();
+    params.mode = ioMode;
+    params.snapshot = true;
+
+    // Step 1: take a snapshot
+    clock::time_point snapshotStart = clock::now();
+
+    MscWriter snapshotWriter(params);
+    Ret ret = writeProject(snapshotWriter, false /*createThumbnail*/);
+    snapshotWriter.close();
+
+    if (!ret) {
+        LOGE() << "[autosave] failed write project snapshot: " << ret.toString();
+        return ret;
+    }
+
+    MscWriter::Snapshot snapshot = snapshotWriter.takeSnapshot();
+    auto snapshotTime = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - snapshotStart);
+
+    // Step 2: compress and write in the background
+    m_autoSaveInProgress->store(true);
+
+    auto inProgress = m_autoSaveInProgress;
+    auto fs = fileSystem();
+    Concurrent::run([fs, inProgress, params, snapshot, savePath, targetContainerPath, targetMainFilePath, snapshotTime]() {
+        DEFER {
+            inProgress->store(false);
+        };
+
+        clock::time_point compressStart = clock::now();
+
+        MscWriter::Params writeParams = params;
+        Buffer buf;
+        writeParams.device = &buf;
+
+        Ret writeRet = MscWriter::writeSnapshot(writeParams, snapshot);
+        if (!writeRet) {
+            LOGE() << "[autosave] failed write project to buffer: " << writeRet.toString();
+            return;
+        }
+
+        clock::time_point writeStart = clock::now();
+
+        writeRet = fs->writeFile(savePath, buf.data());
+        if (!writeRet) {
+            LOGE() << "[autosave] failed to write project file: " << writeRet.toString();
+            return;
+        }
+
+        writeRet = fs->copy(savePath, targetContainerPath, true);
+        if (!writeRet) {
+            LOGE() << "[autosave] failed to copy to target: " << writeRet.toString();
+            return;
+        }
+
+        fs->remove(savePath);
+        QFile::setPermissions(targetMainFilePath.toQString(),
+                              QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser | QFile::ReadGroup | QFile::ReadOther);
+
+        clock::time_point end = clock::now();
+        LOGI() << "[autosave] saved: " << targetContainerPath
+               << ", snapshot: " << snapshotTime.count() << " ms (main thread)"
+               << ", compress: " << std::chrono::duration_cast<std::chrono::milliseconds>(writeStart - compressStart).count() << " ms"
+               << ", write: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - writeStart).count() << " ms";
+    });
+
+    return make_ret(Ret::Code::Ok);
+}
+
 Ret NotationProject::makeBackup(muse::io::path_t filePath)
 {
     TRACEFUNC;
@@ -21,6 +21,9 @@
  */
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include "../inotationproject.h"
 
 #include "async/asyncable.h"
@@ -123,6 +126,7 @@ private:
     muse::Ret exportProject(const muse::io::path_t& path, const std::string& suffix);
     muse::Ret doSave(const muse::io::path_t& path, engraving::MscIoMode ioMode, bool generateBackup = true, bool createThumbnail = true,
                      bool isAutosave = false, const engraving::write::WriteContext* ctx = nullptr);
+    muse::Ret autoSaveInBackground(const muse::io::path_t& path, engraving::MscIoMode ioMode);
     muse::Ret makeBackup(muse::io::path_t filePath);
     muse::Ret writeProject(const muse::io::path_t& path, const engraving::write::WriteContext* ctx = nullptr);
     muse::Ret writeProject(engraving::MscWriter& msczWriter, bool createThumbnail = true,
@@ -152,5 +156,8 @@ private:
     bool m_needSave = false;
     bool m_needAutoSave = false;
     bool m_hasNonUndoStackChanges = false;
+
+    // shared with the background autosave, which may outlive the project
+    std::shared_ptr<std::atomic<bool> > m_autoSaveInProgress = std::make_shared<std::atomic<bool> >(false);
 };
 }
@@ -31,6 +31,15 @@ void NotationWritersRegister::reg(const std::vector<std::string>& suffixes, INot
     }
 }
 
+void NotationWritersRegister::reg(const std::vector<std::string>& suffixes, const WriterCreator& creator)
+{
+    INotationWriterPtr writer = creator();
+    for (const std::string& suffix : suffixes) {
+        m_writers.insert({ suffix, writer });
+        m_creators.insert({ suffix, creator });
+    }
+}
+
 INotationWriterPtr NotationWritersRegister::writer(const std::string& suffix) const
 {
     auto it = m_writers.find(suffix);
@@ -40,3 +49,13 @@ INotationWriterPtr NotationWritersRegister::writer(const std::string& suffix) co
 
     return nullptr;
 }
+
+INotationWriterPtr NotationWritersRegister::newWriter(const std::string& suffix) const
+{
+    auto it = m_creators.find(suffix);
+    if (it != m_creators.end()) {
+        return it->second();
+    }
+
+    return nullptr;
+}
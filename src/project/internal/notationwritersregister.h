@@ -30,10 +30,13 @@ class NotationWritersRegister : public INotationWritersRegister
 {
 public:
     void reg(const std::vector<std::string>& suffixes, INotationWriterPtr writer) override;
+    void reg(const std::vector<std::string>& suffixes, const WriterCreator& creator) override;
     INotationWriterPtr writer(const std::string& suffix) const override;
+    INotationWriterPtr newWriter(const std::string& suffix) const override;
 
 private:
     std::map<std::string, INotationWriterPtr> m_writers;
+    std::map<std::string, WriterCreator> m_creators;
 };
 }
 
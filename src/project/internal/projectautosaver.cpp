@@ -171,6 +171,11 @@ void ProjectAutoSaver::onTrySave()
     muse::io::path_t savePath = project->isNewlyCreated() ? projectPath : projectAutoSavePath(projectPath);
 
     Ret ret = project->save(savePath, SaveMode::AutoSave);
+    if (ret.code() == static_cast<int>(Ret::Code::Cancel)) {
+        LOGD() << "[autosave] previous autosave is still in progress, will retry";
+        return;
+    }
+
     if (!ret) {
         LOGE() << "[autosave] failed to save project, err: " << ret.toString();
         return;
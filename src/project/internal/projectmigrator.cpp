@@ -213,7 +213,7 @@ bool ProjectMigrator::applyLelandStyle(mu::engraving::MasterScore* score)
 {
     muse::io::File styleFile(LELAND_STYLE_PATH);
     for (mu::engraving::Excerpt* excerpt : score->excerpts()) {
-        if (!excerpt->excerptScore()->loadStyle(styleFile, /*ign*/ false, /*overlap*/ true)) {
+        if (!excerpt->ensureExcerptLoaded()->loadStyle(styleFile, /*ign*/ false, /*overlap*/ true)) {
             return false;
         }
     }
@@ -225,7 +225,7 @@ bool ProjectMigrator::applyEdwinStyle(mu::engraving::MasterScore* score)
 {
     muse::io::File styleFile(EDWIN_STYLE_PATH);
     for (mu::engraving::Excerpt* excerpt : score->excerpts()) {
-        if (!excerpt->excerptScore()->loadStyle(styleFile, /*ign*/ false, /*overlap*/ true)) {
+        if (!excerpt->ensureExcerptLoaded()->loadStyle(styleFile, /*ign*/ false, /*overlap*/ true)) {
             return false;
         }
     }
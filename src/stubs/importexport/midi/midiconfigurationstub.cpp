@@ -57,6 +57,36 @@ async::Channel<bool> MidiConfigurationStub::roundTempoChanged() const
     return {};
 }
 
+int MidiConfigurationStub::tupletSearchNodeLimit() const
+{
+    return 0;
+}
+
+void MidiConfigurationStub::setTupletSearchNodeLimit(int)
+{
+    NOT_IMPLEMENTED;
+}
+
+int MidiConfigurationStub::tupletSearchTimeLimit() const
+{
+    return 0;
+}
+
+void MidiConfigurationStub::setTupletSearchTimeLimit(int)
+{
+    NOT_IMPLEMENTED;
+}
+
+bool MidiConfigurationStub::isParallelImport() const
+{
+    return false;
+}
+
+void MidiConfigurationStub::setIsParallelImport(bool)
+{
+    NOT_IMPLEMENTED;
+}
+
 void MidiConfigurationStub::setMidiImportOperationsFile(const std::optional<muse::io::path_t>&) const
 {
     NOT_IMPLEMENTED;
@@ -98,6 +98,16 @@ void MusicXmlConfiguration::setExportInvisibleElements(bool)
     NOT_IMPLEMENTED;
 }
 
+bool MusicXmlConfiguration::exportParallel() const
+{
+    return false;
+}
+
+void MusicXmlConfiguration::setExportParallel(bool)
+{
+    NOT_IMPLEMENTED;
+}
+
 bool MusicXmlConfiguration::needUseDefaultFont() const
 {
     return false;
@@ -0,0 +1,127 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-Studio-CLA-applies
+#
+# MuseScore Studio
+# Music Composition & Notation
+#
+# Copyright (C) 2026 MuseScore Limited and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+echo "MuseScore VTest Batch Jobs"
+
+# Converts the same job file with '--jobs 1' and with '--jobs <count>',
+# and converts every job of it on its own, one after another.
+# Checks that all runs write identical files
+
+set -o pipefail
+
+HERE="$(dirname ${BASH_SOURCE[0]})"
+SCORES_DIR="$HERE/scores_small"
+OUTPUT_DIR="./vtest_batch_jobs"
+MSCORE_BIN=build.debug/install/bin/mscore
+JOBS=4
+
+while [[ "$#" -gt 0 ]]; do
+    case $1 in
+        -s|--scores) SCORES_DIR="$2"; shift ;;
+        -o|--output-dir) OUTPUT_DIR="$2"; shift ;;
+        -m|--mscore) MSCORE_BIN="$2"; shift ;;
+        -j|--jobs) JOBS="$2"; shift ;;
+        *) echo "Unknown parameter passed: $1"; exit 1 ;;
+    esac
+    shift
+done
+
+echo "::group::Configuration:"
+echo "SCORES_DIR: $SCORES_DIR"
+echo "OUTPUT_DIR: $OUTPUT_DIR"
+echo "MSCORE_BIN: $MSCORE_BIN"
+echo "JOBS: $JOBS"
+echo "::endgroup::"
+
+rm -rf $OUTPUT_DIR
+mkdir -p $OUTPUT_DIR
+
+# Every score is exported to several formats, the part export comes before the save
+# of the same score. The last score is also written to the output of the first one,
+# to check that jobs sharing an output are kept in order.
+list_jobs() {
+    local out_dir=$1
+    local scores_list=$(ls -p $SCORES_DIR | grep -v /)
+    local first_out=""
+    local last_score=""
+
+    for score in $scores_list ; do
+        local name=${score%.*}
+        echo "$SCORES_DIR/$score|$out_dir/$name-*.png"
+        for suffix in svg mscx musicxml mid ; do
+            echo "$SCORES_DIR/$score|$out_dir/$name.$suffix"
+        done
+        if [ -z "$first_out" ]; then
+            first_out="$out_dir/$name.musicxml"
+        fi
+        last_score=$score
+    done
+    echo "$SCORES_DIR/$last_score|$first_out"
+}
+
+generate_job_file() {
+    local out_dir=$1
+    local json_file=$2
+
+    mkdir -p $out_dir
+    echo "[" > $json_file
+    list_jobs $out_dir | while IFS="|" read -r in out ; do
+        echo "{ \"in\" : \"$in\", \"out\" : \"$out\" }," >> $json_file
+    done
+    echo "{}]" >> $json_file
+}
+
+convert_one_by_one() {
+    local out_dir=$1
+    local log_file=$2
+
+    mkdir -p $out_dir
+    list_jobs $out_dir | while IFS="|" read -r in out ; do
+        $MSCORE_BIN -o "$out" "$in" 2>&1 | tee -a $log_file || return 1
+    done
+}
+
+echo "::group::Converting"
+generate_job_file $OUTPUT_DIR/serial $OUTPUT_DIR/serial.json
+generate_job_file $OUTPUT_DIR/parallel $OUTPUT_DIR/parallel.json
+
+$MSCORE_BIN -j $OUTPUT_DIR/serial.json --jobs 1 2>&1 | tee $OUTPUT_DIR/serial.log || FAILED="true"
+$MSCORE_BIN -j $OUTPUT_DIR/parallel.json --jobs $JOBS 2>&1 | tee $OUTPUT_DIR/parallel.log || FAILED="true"
+convert_one_by_one $OUTPUT_DIR/single $OUTPUT_DIR/single.log || FAILED="true"
+echo "::endgroup::"
+
+if [ -n "$FAILED" ]; then
+    echo -e "\033[0;31mConverting failed!\033[0m"
+    exit 1
+fi
+
+echo "::group::Comparing"
+if ! diff -r $OUTPUT_DIR/serial $OUTPUT_DIR/parallel; then
+    echo -e "\033[0;31mOutputs of '--jobs $JOBS' differ from '--jobs 1'!\033[0m"
+    exit 1
+fi
+if ! diff -r $OUTPUT_DIR/serial $OUTPUT_DIR/single; then
+    echo -e "\033[0;31mOutputs of the job file differ from converting the jobs one by one!\033[0m"
+    exit 1
+fi
+echo "::endgroup::"
+
+echo "Outputs of '--jobs $JOBS', '--jobs 1' and of the jobs converted one by one are identical"
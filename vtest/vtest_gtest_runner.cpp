@@ -79,3 +79,11 @@ TEST_F(Engraving_VTest, 2_GenerateCurrentAndCompare)
                           { "--gen-gif", "0"
                           }), 0);
 }
+
+TEST_F(Engraving_VTest, 3_BatchJobsMatchSerial)
+{
+    ASSERT_EQ(run_command("vtest-batch-jobs.sh",
+                          { "--mscore", MSCORE_BIN,
+                            "--jobs", "4"
+                          }), 0);
+}